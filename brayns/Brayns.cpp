@@ -26,6 +26,7 @@
 #include <brayns/Version.h>
 
 #include <brayns/utils/Log.h>
+#include <brayns/utils/ThreadPool.h>
 
 #include <brayns/network/common/Clock.h>
 
@@ -72,6 +73,17 @@ private:
     }
 };
 
+class ThreadPoolStartup
+{
+public:
+    static void run(brayns::ParametersManager &parameters)
+    {
+        auto &application = parameters.getApplicationParameters();
+        auto threadCount = application.getThreadCount();
+        brayns::ThreadPool::setDefaultWorkerCount(threadCount);
+    }
+};
+
 class NetworkStartup
 {
 public:
@@ -83,6 +95,17 @@ public:
         return !uri.empty();
     }
 };
+
+class RenderThreadStartup
+{
+public:
+    static bool isEnabled(brayns::PluginAPI &api)
+    {
+        auto &manager = api.getParametersManager();
+        auto &parameters = manager.getApplicationParameters();
+        return parameters.isRenderThreadEnabled();
+    }
+};
 } // namespace
 
 namespace brayns
@@ -93,6 +116,7 @@ Brayns::Brayns(int argc, const char **argv):
     _pluginManager(*this)
 {
     LoggingStartup::run(_parametersManager);
+    ThreadPoolStartup::run(_parametersManager);
 
     Log::info("Registering core loaders.");
     _loaderRegistry = CoreLoaderRegistry::create();
@@ -124,8 +148,13 @@ void Brayns::runAsService()
     {
         throw std::runtime_error("Trying to run a service without URI");
     }
+    if (RenderThreadStartup::isEnabled(*this))
+    {
+        _engine.startRenderThread();
+    }
     Log::info("Brayns service started.");
     _network->run();
+    _engine.stopRenderThread();
 }
 
 Engine &Brayns::getEngine()
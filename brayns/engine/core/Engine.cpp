@@ -126,45 +126,50 @@ Engine::Engine(ParametersManager &parameters):
 
 void Engine::commit()
 {
-    ViewporUpdater::update(_params, _camera, _frameBuffer);
-
-    bool needResetFramebuffer = false;
-    if (_frameBuffer.commit())
-    {
-        Log::debug("[Engine] Framebuffer committed");
-        needResetFramebuffer = true;
-    }
+    synchronize();
+    _commit();
+}
 
-    if (_camera.commit())
-    {
-        Log::debug("[Engine] Camera committed");
-        needResetFramebuffer = true;
-    }
+void Engine::commitAndRender()
+{
+    synchronize();
+    _scene.update(_params);
+    _commit();
+    _render();
+    _params.resetModified();
+}
 
-    if (_renderer.commit())
+void Engine::startRenderThread()
+{
+    if (_renderThread)
     {
-        Log::debug("[Engine] Renderer committed");
-        needResetFramebuffer = true;
+        return;
     }
+    Log::info("[Engine] Starting render thread.");
+    _renderThread = std::make_unique<RenderThread>([this] { return _launchFrame(); }, [this] { _collectFrame(); });
+}
 
-    if (_scene.commit())
-    {
-        Log::debug("[Engine] Scene committed");
-        needResetFramebuffer = true;
-    }
+void Engine::stopRenderThread()
+{
+    _renderThread.reset();
+}
 
-    if (needResetFramebuffer)
+std::unique_lock<RenderThread> Engine::lock()
+{
+    if (!_renderThread)
     {
-        _frameBuffer.clear();
+        return {};
     }
+    return std::unique_lock<RenderThread>(*_renderThread);
 }
 
-void Engine::commitAndRender()
+void Engine::synchronize()
 {
-    _scene.update(_params);
-    commit();
-    _render();
-    _params.resetModified();
+    if (!_renderThread)
+    {
+        return;
+    }
+    _renderThread->synchronize();
 }
 
 Scene &Engine::getScene()
@@ -177,6 +182,11 @@ Framebuffer &Engine::getFramebuffer() noexcept
     return _frameBuffer;
 }
 
+FramebufferPool &Engine::getFramebufferPool() noexcept
+{
+    return _framebufferPool;
+}
+
 Camera &Engine::getCamera() noexcept
 {
     return _camera;
@@ -197,17 +207,84 @@ const ParametersManager &Engine::getParametersManager() const noexcept
     return _params;
 }
 
+void Engine::_commit()
+{
+    ViewporUpdater::update(_params, _camera, _frameBuffer);
+
+    bool needResetFramebuffer = false;
+    if (_frameBuffer.commit())
+    {
+        Log::debug("[Engine] Framebuffer committed");
+        needResetFramebuffer = true;
+    }
+
+    if (_camera.commit())
+    {
+        Log::debug("[Engine] Camera committed");
+        needResetFramebuffer = true;
+    }
+
+    if (_renderer.commit())
+    {
+        Log::debug("[Engine] Renderer committed");
+        needResetFramebuffer = true;
+    }
+
+    if (_scene.commit())
+    {
+        Log::debug("[Engine] Scene committed");
+        needResetFramebuffer = true;
+    }
+
+    if (needResetFramebuffer)
+    {
+        _frameBuffer.clear();
+    }
+}
+
 void Engine::_render()
 {
     // Check wether we should keep rendering or not
-    auto maxSpp = _renderer.getSamplesPerPixel();
-    auto currentSpp = _frameBuffer.getAccumulationFrameCount();
-    if (currentSpp >= maxSpp)
+    if (_isAccumulationComplete())
     {
         return;
     }
 
-    FrameRenderer::synchronous(_camera, _frameBuffer, _renderer, _scene);
+    auto frameTime = FrameRenderer::synchronous(_camera, _frameBuffer, _renderer, _scene);
     _frameBuffer.incrementAccumFrames();
+    _frameBuffer.setFrameTime(frameTime);
+}
+
+std::optional<ospray::cpp::Future> Engine::_launchFrame()
+{
+    _scene.update(_params);
+    _commit();
+    _params.resetModified();
+
+    if (_isAccumulationComplete())
+    {
+        return std::nullopt;
+    }
+
+    _frame = FrameRenderer::asynchronous(_camera, _frameBuffer, _renderer, _scene);
+    return _frame;
+}
+
+void Engine::_collectFrame()
+{
+    _frameBuffer.incrementAccumFrames();
+
+    if (_frame)
+    {
+        _frameBuffer.setFrameTime(_frame->duration());
+        _frame.reset();
+    }
+}
+
+bool Engine::_isAccumulationComplete() const noexcept
+{
+    auto maxSpp = _renderer.getSamplesPerPixel();
+    auto currentSpp = _frameBuffer.getAccumulationFrameCount();
+    return currentSpp >= maxSpp;
 }
 } // namespace brayns
@@ -23,13 +23,20 @@
 
 #include <brayns/engine/camera/Camera.h>
 #include <brayns/engine/framebuffer/Framebuffer.h>
+#include <brayns/engine/framebuffer/FramebufferPool.h>
 #include <brayns/engine/json/EngineFactories.h>
 #include <brayns/engine/renderer/Renderer.h>
 #include <brayns/engine/scene/Scene.h>
 #include <brayns/parameters/ParametersManager.h>
 
+#include "RenderThread.h"
+
 #include <ospray/ospray_cpp/Device.h>
 
+#include <memory>
+#include <mutex>
+#include <optional>
+
 namespace brayns
 {
 /**
@@ -58,6 +65,30 @@ public:
      */
     void commitAndRender();
 
+    /**
+     * @brief Starts rendering accumulation frames continuously on a dedicated thread. Once started, the engine objects
+     * must only be accessed while holding the lock returned by lock().
+     */
+    void startRenderThread();
+
+    /**
+     * @brief Stops the render thread (if any) after the frame in flight has finished.
+     */
+    void stopRenderThread();
+
+    /**
+     * @brief Acquires exclusive access to the engine objects, waiting for the frame in flight if any. Without render
+     * thread, the returned lock is empty.
+     * @return std::unique_lock<RenderThread> Lock released on destruction.
+     */
+    std::unique_lock<RenderThread> lock();
+
+    /**
+     * @brief Waits for the frame being rendered by the render thread, if any. Must be called, while holding the lock,
+     * before committing or rendering engine objects outside of commit() and commitAndRender().
+     */
+    void synchronize();
+
     /**
      * @brief Returns the system's Scene object.
      */
@@ -68,6 +99,12 @@ public:
      */
     Framebuffer &getFramebuffer() noexcept;
 
+    /**
+     * @brief Returns the pool of framebuffer handles shared by the tasks rendering with their own framebuffer
+     * (snapshots, g-buffer exports, ...) to avoid reallocating them on every request.
+     */
+    FramebufferPool &getFramebufferPool() noexcept;
+
     /**
      * @brief Returns the system's current Camera object
      */
@@ -90,12 +127,28 @@ public:
     const ParametersManager &getParametersManager() const noexcept;
 
 private:
+    /**
+     * @brief Commits the engine objects without synchronizing with the render thread.
+     */
+    void _commit();
+
     /**
      * @brief Attempts to render a frame (if accumulation hasnt finish integrating the current frame and/or the
      * contents of the engine have changed).
      */
     void _render();
 
+    /**
+     * @brief Render thread callbacks.
+     */
+    std::optional<ospray::cpp::Future> _launchFrame();
+    void _collectFrame();
+
+    /**
+     * @brief Returns true if the framebuffer has integrated all the samples per pixel requested by the renderer.
+     */
+    bool _isAccumulationComplete() const noexcept;
+
 private:
     /**
      * @brief In charge of managing the lifetime of ospray modules
@@ -114,6 +167,9 @@ private:
     OsprayModuleHandler _moduleHandler;
     ospray::cpp::Device _osprayDevice;
 
+    // Must outlive the frame handlers releasing their handles to it
+    FramebufferPool _framebufferPool;
+
     // System objects
     Framebuffer _frameBuffer;
     Scene _scene;
@@ -121,5 +177,11 @@ private:
     Renderer _renderer;
 
     EngineFactories _factories;
+
+    // Frame launched by the render thread, kept to query its render time once collected
+    std::optional<ospray::cpp::Future> _frame;
+
+    // Must be destroyed first to make sure no frame is in flight when the objects are released
+    std::unique_ptr<RenderThread> _renderThread;
 };
 } // namespace brayns
@@ -24,7 +24,7 @@
 
 namespace brayns
 {
-void FrameRenderer::synchronous(
+float FrameRenderer::synchronous(
     const Camera &camera,
     const Framebuffer &framebuffer,
     const Renderer &renderer,
@@ -32,6 +32,7 @@ void FrameRenderer::synchronous(
 {
     auto future = asynchronous(camera, framebuffer, renderer, scene);
     future.wait();
+    return future.duration();
 }
 
 ospray::cpp::Future FrameRenderer::asynchronous(
@@ -36,8 +36,9 @@ public:
      * @param fb
      * @param renderer
      * @param scene
+     * @return float Render time in seconds.
      */
-    static void synchronous(
+    static float synchronous(
         const Camera &camera,
         const Framebuffer &framebuffer,
         const Renderer &renderer,
@@ -0,0 +1,74 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "RenderJob.h"
+
+#include "FrameRenderer.h"
+
+namespace
+{
+class CompletionSignal
+{
+public:
+    static std::future<void> create(const ospray::cpp::Future &future)
+    {
+        return std::async(std::launch::async, [=] { future.wait(); });
+    }
+};
+}
+
+namespace brayns
+{
+RenderJob::RenderJob(const Camera &camera, const Framebuffer &framebuffer, const Renderer &renderer, const Scene &scene):
+    _future(FrameRenderer::asynchronous(camera, framebuffer, renderer, scene)),
+    _completion(CompletionSignal::create(_future))
+{
+}
+
+RenderJob::~RenderJob()
+{
+    if (waitFor(std::chrono::milliseconds(0)))
+    {
+        return;
+    }
+    cancel();
+    wait();
+}
+
+bool RenderJob::waitFor(std::chrono::milliseconds timeout) const
+{
+    return _completion.wait_for(timeout) == std::future_status::ready;
+}
+
+void RenderJob::wait() const
+{
+    _completion.wait();
+}
+
+float RenderJob::getProgress() const
+{
+    return _future.progress();
+}
+
+void RenderJob::cancel()
+{
+    _future.cancel();
+}
+}
@@ -0,0 +1,89 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/engine/camera/Camera.h>
+#include <brayns/engine/framebuffer/Framebuffer.h>
+#include <brayns/engine/renderer/Renderer.h>
+#include <brayns/engine/scene/Scene.h>
+
+#include <ospray/ospray_cpp/Future.h>
+
+#include <chrono>
+#include <future>
+
+namespace brayns
+{
+/**
+ * @brief Asynchronous frame rendering which can be waited with a timeout. Completion is signaled as soon as OSPRay
+ * finishes the frame, without polling the future state.
+ *
+ * If the job is destroyed before the frame is finished (for example when the request is cancelled), the frame is
+ * cancelled and the destructor waits for OSPRay to release the objects.
+ */
+class RenderJob
+{
+public:
+    /**
+     * @brief Launches the rendering of a frame with the given objects, which must be committed and remain alive until
+     * the job is finished.
+     * @param camera
+     * @param framebuffer
+     * @param renderer
+     * @param scene
+     */
+    RenderJob(const Camera &camera, const Framebuffer &framebuffer, const Renderer &renderer, const Scene &scene);
+    ~RenderJob();
+
+    RenderJob(const RenderJob &) = delete;
+    RenderJob &operator=(const RenderJob &) = delete;
+
+    RenderJob(RenderJob &&) = delete;
+    RenderJob &operator=(RenderJob &&) = delete;
+
+    /**
+     * @brief Waits until the frame is finished or the timeout expires.
+     * @param timeout Maximum time to wait.
+     * @return true If the frame is finished.
+     */
+    bool waitFor(std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Waits until the frame is finished.
+     */
+    void wait() const;
+
+    /**
+     * @brief Returns the frame rendering progress [0-1].
+     * @return float
+     */
+    float getProgress() const;
+
+    /**
+     * @brief Requests OSPRay to stop rendering the frame as soon as possible.
+     */
+    void cancel();
+
+private:
+    ospray::cpp::Future _future;
+    std::future<void> _completion;
+};
+}
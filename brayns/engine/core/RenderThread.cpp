@@ -0,0 +1,130 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "RenderThread.h"
+
+#include <brayns/utils/Log.h>
+
+#include <utility>
+
+namespace brayns
+{
+RenderThread::RenderThread(FrameLauncher launcher, FrameCollector collector):
+    _launcher(std::move(launcher)),
+    _collector(std::move(collector)),
+    _thread([this] { _run(); })
+{
+}
+
+RenderThread::~RenderThread()
+{
+    {
+        auto lock = std::lock_guard(_mutex);
+        _running = false;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+void RenderThread::lock()
+{
+    auto lock = std::unique_lock(_mutex);
+
+    // Registered so that the render thread does not launch another frame while a lock is waiting
+    ++_lockRequests;
+    _condition.wait(lock, [this] { return !_locked && !_inFlight; });
+    --_lockRequests;
+
+    _locked = true;
+}
+
+void RenderThread::unlock()
+{
+    {
+        auto lock = std::lock_guard(_mutex);
+        _locked = false;
+        _pending = true;
+    }
+    _condition.notify_all();
+}
+
+void RenderThread::synchronize()
+{
+    auto lock = std::unique_lock(_mutex);
+    _condition.wait(lock, [this] { return !_inFlight; });
+    _collect();
+}
+
+void RenderThread::_run()
+{
+    Log::debug("[Engine] Render thread started");
+
+    auto lock = std::unique_lock(_mutex);
+
+    while (true)
+    {
+        _condition.wait(lock, [this] { return !_running || (!_locked && _lockRequests == 0 && _pending); });
+
+        if (!_running)
+        {
+            break;
+        }
+
+        auto future = std::optional<ospray::cpp::Future>();
+
+        try
+        {
+            _collect();
+            future = _launcher();
+        }
+        catch (const std::exception &e)
+        {
+            Log::error("[Engine] Render thread failed to launch frame: '{}'.", e.what());
+        }
+
+        if (!future)
+        {
+            _pending = false;
+            continue;
+        }
+
+        _inFlight = true;
+        lock.unlock();
+
+        future->wait();
+
+        lock.lock();
+        _inFlight = false;
+        _frameReady = true;
+        _condition.notify_all();
+    }
+
+    Log::debug("[Engine] Render thread stopped");
+}
+
+void RenderThread::_collect()
+{
+    if (!std::exchange(_frameReady, false))
+    {
+        return;
+    }
+    _collector();
+}
+}
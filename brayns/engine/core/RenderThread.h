@@ -0,0 +1,107 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <ospray/ospray_cpp/Future.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace brayns
+{
+/**
+ * @brief Renders accumulation frames continuously on a dedicated thread.
+ *
+ * The committed OSPRay objects share the memory of the brayns objects (geometry, colors, transfer functions...), so
+ * entrypoints can only modify the engine once the frame in flight is finished. Acquiring the lock waits for it and
+ * prevents the render thread from launching a new frame until the lock is released, when the pending changes are
+ * committed before the next frame.
+ *
+ * The class satisfies the BasicLockable requirements so it can be used with std::unique_lock.
+ */
+class RenderThread
+{
+public:
+    /**
+     * @brief Commits the pending changes and launches a new frame. Returns an empty optional if there is nothing to
+     * render. Always called with exclusive access to the engine.
+     */
+    using FrameLauncher = std::function<std::optional<ospray::cpp::Future>()>;
+
+    /**
+     * @brief Called with exclusive access to the engine once a frame launched has finished rendering.
+     */
+    using FrameCollector = std::function<void()>;
+
+    /**
+     * @brief Starts the render thread.
+     *
+     * @param launcher Callback to commit and launch a new frame.
+     * @param collector Callback to collect a finished frame.
+     */
+    RenderThread(FrameLauncher launcher, FrameCollector collector);
+    ~RenderThread();
+
+    RenderThread(const RenderThread &) = delete;
+    RenderThread &operator=(const RenderThread &) = delete;
+
+    RenderThread(RenderThread &&) = delete;
+    RenderThread &operator=(RenderThread &&) = delete;
+
+    /**
+     * @brief Acquires exclusive access to the engine objects, waiting for an ongoing commit and for the frame in
+     * flight. No new frame will be launched until unlock() is called.
+     */
+    void lock();
+
+    /**
+     * @brief Releases the exclusive access and wakes up the render thread to commit the changes.
+     */
+    void unlock();
+
+    /**
+     * @brief Waits for the frame in flight, if any, and collects it. Must be called while holding the lock before
+     * committing or rendering engine objects outside the render thread.
+     */
+    void synchronize();
+
+private:
+    void _run();
+    void _collect();
+
+private:
+    FrameLauncher _launcher;
+    FrameCollector _collector;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _running = true;
+    bool _locked = false;
+    size_t _lockRequests = 0;
+    bool _pending = true;
+    bool _inFlight = false;
+    bool _frameReady = false;
+    std::thread _thread;
+};
+}
@@ -73,6 +73,11 @@ void Framebuffer::incrementAccumFrames() noexcept
     _frame->incrementAccumFrames();
 }
 
+void Framebuffer::setFrameTime(float seconds) noexcept
+{
+    _frame->setFrameTime(seconds);
+}
+
 size_t Framebuffer::getAccumulationFrameCount() const noexcept
 {
     return _frame->getAccumulationFrameCount();
@@ -94,6 +94,14 @@ public:
      */
     void incrementAccumFrames() noexcept;
 
+    /**
+     * @brief Reports the time it took to render the last accumulation frame, so that the frame handler can adapt
+     * the resolution of the next ones.
+     *
+     * @param seconds Render time of the last frame in seconds.
+     */
+    void setFrameTime(float seconds) noexcept;
+
     /**
      * @brief Returns the number of accumulation frames integrated into this framebuffer. If
      * not in accumulation mode, the result has no meaning.
@@ -0,0 +1,131 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "FramebufferPool.h"
+
+#include <algorithm>
+
+namespace brayns
+{
+bool FramebufferKey::operator==(const FramebufferKey &other) const noexcept
+{
+    return frameSize == other.frameSize && format == other.format && channels == other.channels
+        && toneMapping == other.toneMapping;
+}
+
+size_t FramebufferKey::getByteSize() const noexcept
+{
+    auto pixelSize = size_t(0);
+
+    if (channels & OSP_FB_COLOR)
+    {
+        pixelSize += format == PixelFormat::RgbaF32 ? 4 * sizeof(float) : 4;
+    }
+    if (channels & OSP_FB_DEPTH)
+    {
+        pixelSize += sizeof(float);
+    }
+    if (channels & OSP_FB_ACCUM)
+    {
+        pixelSize += 4 * sizeof(float);
+    }
+    if (channels & OSP_FB_VARIANCE)
+    {
+        pixelSize += 4 * sizeof(float);
+    }
+    if (channels & OSP_FB_NORMAL)
+    {
+        pixelSize += 3 * sizeof(float);
+    }
+    if (channels & OSP_FB_ALBEDO)
+    {
+        pixelSize += 3 * sizeof(float);
+    }
+
+    return size_t(frameSize.x) * size_t(frameSize.y) * pixelSize;
+}
+
+FramebufferPool::FramebufferPool(size_t capacity, size_t byteBudget):
+    _capacity(capacity),
+    _byteBudget(byteBudget)
+{
+}
+
+std::optional<ospray::cpp::FrameBuffer> FramebufferPool::acquire(const FramebufferKey &key)
+{
+    auto lock = std::lock_guard(_mutex);
+
+    auto predicate = [&](auto &entry) { return entry.key == key; };
+    auto it = std::find_if(_entries.rbegin(), _entries.rend(), predicate);
+
+    if (it == _entries.rend())
+    {
+        return std::nullopt;
+    }
+
+    auto handle = std::move(it->handle);
+    _byteSize -= key.getByteSize();
+    _entries.erase(std::next(it).base());
+    return handle;
+}
+
+void FramebufferPool::release(const FramebufferKey &key, ospray::cpp::FrameBuffer handle)
+{
+    auto byteSize = key.getByteSize();
+
+    if (!handle.handle() || _capacity == 0 || byteSize > _byteBudget)
+    {
+        return;
+    }
+
+    auto lock = std::lock_guard(_mutex);
+
+    auto count = size_t(0);
+    auto budget = _byteSize + byteSize;
+    while (_entries.size() - count >= _capacity || budget > _byteBudget)
+    {
+        budget -= _entries[count].key.getByteSize();
+        ++count;
+    }
+
+    _entries.erase(_entries.begin(), _entries.begin() + static_cast<std::ptrdiff_t>(count));
+    _entries.push_back({key, std::move(handle)});
+    _byteSize = budget;
+}
+
+void FramebufferPool::clear()
+{
+    auto lock = std::lock_guard(_mutex);
+    _entries.clear();
+    _byteSize = 0;
+}
+
+size_t FramebufferPool::getSize() const
+{
+    auto lock = std::lock_guard(_mutex);
+    return _entries.size();
+}
+
+size_t FramebufferPool::getByteSize() const
+{
+    auto lock = std::lock_guard(_mutex);
+    return _byteSize;
+}
+}
@@ -0,0 +1,117 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/engine/framebuffer/PixelFormat.h>
+#include <brayns/utils/MathTypes.h>
+
+#include <ospray/ospray_cpp/FrameBuffer.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace brayns
+{
+/**
+ * @brief Settings identifying a framebuffer handle. Two handles created with the same key are interchangeable.
+ */
+struct FramebufferKey
+{
+    Vector2ui frameSize;
+    PixelFormat format = PixelFormat::StandardRgbaI8;
+    uint32_t channels = 0;
+    bool toneMapping = false;
+
+    bool operator==(const FramebufferKey &other) const noexcept;
+
+    /**
+     * @brief Estimates the memory used by a framebuffer created with these settings.
+     *
+     * @return size_t Size in bytes of the pixels of all channels.
+     */
+    size_t getByteSize() const noexcept;
+};
+
+/**
+ * @brief Keeps the released framebuffer handles alive so subsequent requests with the same settings can reuse them
+ * instead of reallocating the OSPRay buffers (expensive for high resolution snapshots and g-buffers).
+ *
+ * The idle handles are bounded both in count and in memory, the least recently released being dropped first. Tiled
+ * snapshots produce at most four distinct tile sizes, so the default count keeps room for the other framebuffers.
+ */
+class FramebufferPool
+{
+public:
+    /**
+     * @brief Construct a pool holding at most capacity idle handles using at most byteBudget bytes.
+     *
+     * @param capacity Max number of idle handles.
+     * @param byteBudget Max memory used by the idle handles, a bigger handle is never kept.
+     */
+    explicit FramebufferPool(size_t capacity = 8, size_t byteBudget = size_t(256) << 20);
+
+    /**
+     * @brief Takes an idle handle matching the given key out of the pool, if any.
+     *
+     * @param key Settings of the requested framebuffer.
+     * @return std::optional<ospray::cpp::FrameBuffer> Handle or empty if none is available.
+     */
+    std::optional<ospray::cpp::FrameBuffer> acquire(const FramebufferKey &key);
+
+    /**
+     * @brief Gives a handle back to the pool once its owner doesn't need it anymore.
+     *
+     * @param key Settings used to create the handle.
+     * @param handle Framebuffer handle.
+     */
+    void release(const FramebufferKey &key, ospray::cpp::FrameBuffer handle);
+
+    /**
+     * @brief Releases all idle handles.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of idle handles.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the estimated memory used by the idle handles.
+     */
+    size_t getByteSize() const;
+
+private:
+    struct Entry
+    {
+        FramebufferKey key;
+        ospray::cpp::FrameBuffer handle;
+    };
+
+    size_t _capacity;
+    size_t _byteBudget;
+    size_t _byteSize = 0;
+    std::vector<Entry> _entries;
+    mutable std::mutex _mutex;
+};
+}
@@ -83,6 +83,11 @@ public:
      */
     virtual void incrementAccumFrames() noexcept = 0;
 
+    /**
+     * @copydoc Framebuffer::setFrameTime(float)
+     */
+    virtual void setFrameTime(float seconds) noexcept = 0;
+
     /**
      * @copydoc Framebuffer::getAccumulationFrameCount()
      */
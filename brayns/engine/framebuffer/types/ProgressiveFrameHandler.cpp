@@ -20,7 +20,7 @@
 
 #include "ProgressiveFrameHandler.h"
 
-#include <utility>
+#include <algorithm>
 
 namespace
 {
@@ -34,91 +34,174 @@ public:
         return frameSize / applyScale;
     }
 };
+
+class ScaleLevels
+{
+public:
+    static std::vector<uint32_t> build(uint32_t scale, bool adaptive)
+    {
+        auto scales = std::vector<uint32_t>{scale};
+
+        while (adaptive && scale > 2)
+        {
+            scale = (scale + 1) / 2;
+            scales.push_back(scale);
+        }
+
+        if (scales.back() != 1)
+        {
+            scales.push_back(1);
+        }
+
+        return scales;
+    }
+};
 }
 
 namespace brayns
 {
-ProgressiveFrameHandler::ProgressiveFrameHandler(uint32_t scale):
-    _scale(scale)
+ProgressiveFrameHandler::ProgressiveFrameHandler(uint32_t scale, uint32_t targetFrameTime):
+    _targetFrameTime(static_cast<float>(targetFrameTime) / 1000.0f)
 {
-    if (_scale == 0)
+    if (scale == 0)
     {
         throw std::invalid_argument("Cannot set a 0 scale on progressive framebuffer");
     }
 
+    _scales = ScaleLevels::build(scale, targetFrameTime != 0);
+
+    for (size_t i = 0; i < _scales.size(); ++i)
+    {
+        _levels.push_back(std::make_unique<StaticFrameHandler>());
+    }
+
     setFrameSize({800, 600});
 }
 
 bool ProgressiveFrameHandler::commit()
 {
-    _lowRes.commit();
-    return _highRes.commit();
+    auto last = _levels.size() - 1;
+    for (size_t i = 0; i < last; ++i)
+    {
+        _levels[i]->commit();
+    }
+    return _levels[last]->commit();
 }
 
 void ProgressiveFrameHandler::setFrameSize(const Vector2ui &frameSize)
 {
-    _lowRes.setFrameSize(FrameSizeScaler::safeScale(frameSize, _scale));
-    _highRes.setFrameSize(frameSize);
+    for (size_t i = 0; i < _levels.size(); ++i)
+    {
+        _levels[i]->setFrameSize(FrameSizeScaler::safeScale(frameSize, _scales[i]));
+    }
+    _frameSize = frameSize;
 }
 
 void ProgressiveFrameHandler::setAccumulation(bool accumulation) noexcept
 {
-    _highRes.setAccumulation(accumulation);
+    _levels.back()->setAccumulation(accumulation);
 }
 
 void ProgressiveFrameHandler::setFormat(PixelFormat frameBufferFormat) noexcept
 {
-    _lowRes.setFormat(frameBufferFormat);
-    _highRes.setFormat(frameBufferFormat);
+    for (auto &level : _levels)
+    {
+        level->setFormat(frameBufferFormat);
+    }
 }
 
 void ProgressiveFrameHandler::setChannels(const std::vector<brayns::FramebufferChannel> &channels) noexcept
 {
-    _lowRes.setChannels(channels);
-    _highRes.setChannels(channels);
+    for (auto &level : _levels)
+    {
+        level->setChannels(channels);
+    }
 }
 
 void ProgressiveFrameHandler::setToneMappingEnabled(bool enabled) noexcept
 {
-    _lowRes.setToneMappingEnabled(enabled);
-    _highRes.setToneMappingEnabled(enabled);
+    for (auto &level : _levels)
+    {
+        level->setToneMappingEnabled(enabled);
+    }
 }
 
 void ProgressiveFrameHandler::clear() noexcept
 {
-    _lowResFrame = true;
-    _lowRes.clear();
-    _highRes.clear();
+    for (auto &level : _levels)
+    {
+        level->clear();
+    }
+    _current = _getStartLevel();
+    _displayed = _current;
 }
 
 void ProgressiveFrameHandler::incrementAccumFrames() noexcept
 {
-    (_lowResFrame ? _lowRes : _highRes).incrementAccumFrames();
+    _levels[_current]->incrementAccumFrames();
+    _displayed = _current;
+    _current = std::min(_current + 1, _levels.size() - 1);
+}
+
+void ProgressiveFrameHandler::setFrameTime(float seconds) noexcept
+{
+    auto pixelTime = seconds / static_cast<float>(_getPixelCount(_displayed));
+
+    // Smooth the estimation as render times are noisy and depend on the view
+    _pixelTime = _pixelTime == 0.0f ? pixelTime : 0.5f * (_pixelTime + pixelTime);
 }
 
 size_t ProgressiveFrameHandler::getAccumulationFrameCount() const noexcept
 {
-    return _lowRes.getAccumulationFrameCount() + _highRes.getAccumulationFrameCount();
+    // Reduced resolution frames are previews, only full resolution ones are accumulated
+    return _levels.back()->getAccumulationFrameCount();
 }
 
 bool ProgressiveFrameHandler::hasNewAccumulationFrame() const noexcept
 {
-    return (_lowResFrame ? _lowRes : _highRes).hasNewAccumulationFrame();
+    return _levels[_displayed]->hasNewAccumulationFrame();
 }
 
 void ProgressiveFrameHandler::resetNewAccumulationFrame() noexcept
 {
-    _lowRes.resetNewAccumulationFrame();
-    _highRes.resetNewAccumulationFrame();
+    for (auto &level : _levels)
+    {
+        level->resetNewAccumulationFrame();
+    }
 }
 
 Image ProgressiveFrameHandler::getImage(brayns::FramebufferChannel channel)
 {
-    return (std::exchange(_lowResFrame, false) ? _lowRes : _highRes).getImage(channel);
+    return _levels[_displayed]->getImage(channel);
 }
 
 const ospray::cpp::FrameBuffer &ProgressiveFrameHandler::getHandle() const noexcept
 {
-    return (_lowResFrame ? _lowRes : _highRes).getHandle();
+    return _levels[_current]->getHandle();
+}
+
+size_t ProgressiveFrameHandler::_getPixelCount(size_t level) const noexcept
+{
+    auto frameSize = FrameSizeScaler::safeScale(_frameSize, _scales[level]);
+    return static_cast<size_t>(frameSize.x) * static_cast<size_t>(frameSize.y);
+}
+
+size_t ProgressiveFrameHandler::_getStartLevel() const noexcept
+{
+    if (_targetFrameTime == 0.0f || _pixelTime == 0.0f)
+    {
+        return 0;
+    }
+
+    for (auto level = _levels.size() - 1; level > 0; --level)
+    {
+        auto frameTime = _pixelTime * static_cast<float>(_getPixelCount(level));
+        if (frameTime <= _targetFrameTime)
+        {
+            return level;
+        }
+    }
+
+    return 0;
 }
 }
@@ -24,12 +24,30 @@
 
 #include "StaticFrameHandler.h"
 
+#include <memory>
+
 namespace brayns
 {
+/**
+ * @brief Renders the first frames after a change at a reduced resolution, then ramps up to full resolution.
+ *
+ * Without target frame time, a single frame is rendered at the given scale before switching to full resolution.
+ *
+ * With a target frame time, the render time of each frame is used to estimate the cost of a pixel. After a change,
+ * rendering starts at the highest resolution expected to fit the target (down to the given scale), then the
+ * resolution is doubled on each frame until full resolution is reached.
+ */
 class ProgressiveFrameHandler final : public IFrameHandler
 {
 public:
-    explicit ProgressiveFrameHandler(uint32_t scale = 4);
+    /**
+     * @brief Construct a progressive frame handler.
+     *
+     * @param scale Max frame size reduction factor.
+     * @param targetFrameTime Target render time in milliseconds of the first frame after a change, 0 to disable.
+     * @throw std::invalid_argument Scale is 0.
+     */
+    explicit ProgressiveFrameHandler(uint32_t scale = 4, uint32_t targetFrameTime = 0);
 
     bool commit() override;
 
@@ -41,6 +59,7 @@ public:
     void clear() noexcept override;
 
     void incrementAccumFrames() noexcept override;
+    void setFrameTime(float seconds) noexcept override;
     size_t getAccumulationFrameCount() const noexcept override;
     bool hasNewAccumulationFrame() const noexcept override;
     void resetNewAccumulationFrame() noexcept override;
@@ -50,9 +69,19 @@ public:
     const ospray::cpp::FrameBuffer &getHandle() const noexcept override;
 
 private:
-    bool _lowResFrame = true;
-    uint32_t _scale;
-    StaticFrameHandler _lowRes;
-    StaticFrameHandler _highRes;
+    size_t _getPixelCount(size_t level) const noexcept;
+    size_t _getStartLevel() const noexcept;
+
+private:
+    float _targetFrameTime;
+    float _pixelTime = 0.0f;
+    Vector2ui _frameSize;
+    std::vector<uint32_t> _scales;
+    // One handler per scale, from the lowest resolution to the full resolution one
+    std::vector<std::unique_ptr<StaticFrameHandler>> _levels;
+    // Level rendered next
+    size_t _current = 0;
+    // Level of the last frame rendered
+    size_t _displayed = 0;
 };
 }
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <unordered_set>
+#include <utility>
 
 namespace
 {
@@ -160,6 +161,27 @@ public:
     }
 };
 
+class FrameHandleFactory
+{
+public:
+    static ospray::cpp::FrameBuffer create(const brayns::FramebufferKey &key)
+    {
+        auto width = static_cast<int>(key.frameSize.x);
+        auto height = static_cast<int>(key.frameSize.y);
+        auto format = OsprayFrameBufferFormat::fromPixelFormat(key.format);
+        auto handle = ospray::cpp::FrameBuffer(width, height, format, key.channels);
+
+        if (key.toneMapping)
+        {
+            auto toneMapping = brayns::ToneMappingFactory::create();
+            handle.setParam(FrameBufferParameters::operations, ospray::cpp::CopiedData(&toneMapping, 1));
+        }
+
+        handle.commit();
+        return handle;
+    }
+};
+
 class FrameStream
 {
 public:
@@ -202,6 +224,16 @@ private:
 
 namespace brayns
 {
+StaticFrameHandler::StaticFrameHandler(FramebufferPool &pool):
+    _pool(&pool)
+{
+}
+
+StaticFrameHandler::~StaticFrameHandler()
+{
+    _release();
+}
+
 bool StaticFrameHandler::commit()
 {
     if (!_flag)
@@ -209,19 +241,11 @@ bool StaticFrameHandler::commit()
         return false;
     }
 
-    auto width = static_cast<int>(_frameSize.x);
-    auto height = static_cast<int>(_frameSize.y);
-    auto format = OsprayFrameBufferFormat::fromPixelFormat(_format);
-    auto channels = OsprayFrameBufferChannel::buildMask(_channels, _accumulation);
-    _handle = ospray::cpp::FrameBuffer(width, height, format, channels);
-
-    if (_toneMapping)
-    {
-        auto toneMapping = ToneMappingFactory::create();
-        _handle.setParam(FrameBufferParameters::operations, ospray::cpp::CopiedData(&toneMapping, 1));
-    }
+    _release();
 
-    _handle.commit();
+    _key = _getKey();
+    auto handle = _pool ? _pool->acquire(_key) : std::nullopt;
+    _handle = handle ? std::move(*handle) : FrameHandleFactory::create(_key);
 
     clear();
     _flag = false;
@@ -271,6 +295,11 @@ void StaticFrameHandler::incrementAccumFrames() noexcept
     _newAccumulationFrame = true;
 }
 
+void StaticFrameHandler::setFrameTime(float seconds) noexcept
+{
+    (void)seconds;
+}
+
 size_t StaticFrameHandler::getAccumulationFrameCount() const noexcept
 {
     return _accumFrames;
@@ -310,4 +339,23 @@ const ospray::cpp::FrameBuffer &StaticFrameHandler::getHandle() const noexcept
 {
     return _handle;
 }
+
+FramebufferKey StaticFrameHandler::_getKey() const
+{
+    auto key = FramebufferKey();
+    key.frameSize = _frameSize;
+    key.format = _format;
+    key.channels = OsprayFrameBufferChannel::buildMask(_channels, _accumulation);
+    key.toneMapping = _toneMapping;
+    return key;
+}
+
+void StaticFrameHandler::_release()
+{
+    if (!_pool || !_handle.handle())
+    {
+        return;
+    }
+    _pool->release(_key, std::exchange(_handle, ospray::cpp::FrameBuffer()));
+}
 }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <brayns/engine/framebuffer/FramebufferPool.h>
 #include <brayns/engine/framebuffer/IFrameHandler.h>
 #include <brayns/utils/ModifiedFlag.h>
 
@@ -28,6 +29,24 @@ namespace brayns
 class StaticFrameHandler final : public IFrameHandler
 {
 public:
+    StaticFrameHandler() = default;
+
+    /**
+     * @brief Construct a handler recycling its framebuffer handles through the given pool. The pool must outlive
+     * the handler.
+     *
+     * @param pool Pool to acquire handles from and release them to.
+     */
+    explicit StaticFrameHandler(FramebufferPool &pool);
+
+    ~StaticFrameHandler() override;
+
+    StaticFrameHandler(const StaticFrameHandler &) = delete;
+    StaticFrameHandler &operator=(const StaticFrameHandler &) = delete;
+
+    StaticFrameHandler(StaticFrameHandler &&) = delete;
+    StaticFrameHandler &operator=(StaticFrameHandler &&) = delete;
+
     bool commit() override;
 
     void setFrameSize(const Vector2ui &frameSize) override;
@@ -38,6 +57,7 @@ public:
     void clear() noexcept override;
 
     void incrementAccumFrames() noexcept override;
+    void setFrameTime(float seconds) noexcept override;
     size_t getAccumulationFrameCount() const noexcept override;
     bool hasNewAccumulationFrame() const noexcept override;
     void resetNewAccumulationFrame() noexcept override;
@@ -47,6 +67,11 @@ public:
     const ospray::cpp::FrameBuffer &getHandle() const noexcept override;
 
 private:
+    FramebufferKey _getKey() const;
+    void _release();
+
+private:
+    FramebufferPool *_pool = nullptr;
     Vector2ui _frameSize = Vector2ui(800u, 600u);
     PixelFormat _format = PixelFormat::StandardRgbaI8;
     std::vector<FramebufferChannel> _channels{FramebufferChannel::Color};
@@ -55,6 +80,7 @@ private:
     bool _newAccumulationFrame = false;
     bool _toneMapping = true;
     ospray::cpp::FrameBuffer _handle;
+    FramebufferKey _key;
     ModifiedFlag _flag;
 };
 }
@@ -34,6 +34,7 @@ Geometry &Geometry::operator=(Geometry &&other) noexcept
     _handle = std::move(other._handle);
     _data = std::move(other._data);
     _flag = std::move(other._flag);
+    _primitivesModified = other._primitivesModified;
     return *this;
 }
 
@@ -64,12 +65,16 @@ Bounds Geometry::computeBounds(const TransformMatrix &matrix) const noexcept
 
 bool Geometry::commit()
 {
-    if (!_flag)
+    if (!_flag && !_primitivesModified)
     {
         return false;
     }
-    _data->pushTo(_handle);
+    if (_flag)
+    {
+        _data->pushTo(_handle);
+    }
     _flag = false;
+    _primitivesModified = false;
     _handle.commit();
     return true;
 }
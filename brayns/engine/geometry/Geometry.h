@@ -97,6 +97,27 @@ public:
         _flag.setModified(true);
     }
 
+    /**
+     * @brief Same as forEach() but for updates that do not change the primitive count. The OSPRay data arrays share the
+     * primitive memory, so they are kept as is (no index buffer rebuild nor copy) and the next commit only commits the
+     * OSPRay geometry again.
+     *
+     * @tparam Callable The callback type
+     * @param callback Callback to apply to each primitive, with the signature void(<primitive type>&)
+     */
+    template<typename Callable>
+    void forEachInPlace(Callable &&callback) noexcept
+    {
+        using ArgType = DecayFirstArgType<Callable>;
+        assert(dynamic_cast<GeometryData<ArgType> *>(_data.get()));
+        auto &cast = static_cast<GeometryData<ArgType> &>(*_data);
+        for (auto &element : cast.primitives)
+        {
+            callback(element);
+        }
+        _primitivesModified = true;
+    }
+
     /**
      * @brief Return the number of primitives that make up this geometry.
      * @return size_t number of primitives.
@@ -130,5 +151,6 @@ private:
     ospray::cpp::Geometry _handle;
     std::unique_ptr<IGeometryData> _data;
     ModifiedFlag _flag;
+    bool _primitivesModified = false;
 };
 }
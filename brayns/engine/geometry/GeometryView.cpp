@@ -61,6 +61,23 @@ void GeometryView::setColor(const Vector4f &color)
     _handle.setParam(GeometryViewParameters::color, color);
     _handle.removeParam(GeometryViewParameters::index);
     _flag.setModified(true);
+    _colorMap = false;
+    ++_colorVersion;
+}
+
+bool GeometryView::hasColorMap() const noexcept
+{
+    return _colorMap;
+}
+
+size_t GeometryView::getColorVersion() const noexcept
+{
+    return _colorVersion;
+}
+
+void GeometryView::notifyColorsChanged()
+{
+    _flag.setModified(true);
 }
 
 bool GeometryView::commit()
@@ -84,6 +101,8 @@ void GeometryView::_setColorPerPrimitive(const OSPData handle)
     _handle.setParam(GeometryViewParameters::color, OSPDataType::OSP_DATA, &handle);
     _handle.removeParam(GeometryViewParameters::index);
     _flag.setModified(true);
+    _colorMap = false;
+    ++_colorVersion;
 }
 
 void GeometryView::_setColorMap(const OSPData indexHandle, const OSPData colorHandle)
@@ -91,5 +110,7 @@ void GeometryView::_setColorMap(const OSPData indexHandle, const OSPData colorHa
     _handle.setParam(GeometryViewParameters::index, OSPDataType::OSP_DATA, &indexHandle);
     _handle.setParam(GeometryViewParameters::color, OSPDataType::OSP_DATA, &colorHandle);
     _flag.setModified(true);
+    _colorMap = true;
+    ++_colorVersion;
 }
 }
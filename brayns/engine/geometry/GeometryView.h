@@ -55,6 +55,23 @@ public:
         _setColorMap(indices.handle(), colors.handle());
     }
 
+    /**
+     * @brief Checks whether the view is currently colored with an indexed colormap.
+     */
+    bool hasColorMap() const noexcept;
+
+    /**
+     * @brief Returns a counter incremented each time the colors of the view are set, so that the owner of shared
+     * color buffers can check that the view still references them.
+     */
+    size_t getColorVersion() const noexcept;
+
+    /**
+     * @brief Flags the view to be committed again after the content of its shared color buffers (per primitive
+     * colors or colormap) has been updated in place.
+     */
+    void notifyColorsChanged();
+
     bool commit();
 
     const ospray::cpp::GeometricModel &getHandle() const noexcept;
@@ -66,5 +83,7 @@ private:
 private:
     ospray::cpp::GeometricModel _handle;
     ModifiedFlag _flag;
+    bool _colorMap = false;
+    size_t _colorVersion = 0;
 };
 }
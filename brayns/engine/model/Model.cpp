@@ -22,6 +22,7 @@
 #include "Model.h"
 
 #include <brayns/engine/components/ClipperViews.h>
+#include <brayns/engine/components/DynamicGeometry.h>
 #include <brayns/engine/components/GeometryViews.h>
 #include <brayns/engine/components/Lights.h>
 #include <brayns/engine/components/VolumeViews.h>
@@ -38,6 +39,10 @@ public:
         _add<ospray::cpp::VolumetricModel, brayns::VolumeViews>(components, group, _volumeParam);
         _add<ospray::cpp::GeometricModel, brayns::ClipperViews>(components, group, _clippingParam);
         _add<ospray::cpp::Light, brayns::Lights>(components, group, _lightParam);
+        if (components.has<brayns::DynamicGeometry>())
+        {
+            group.setParam(_dynamicParam, true);
+        }
         group.commit();
         return group;
     }
@@ -47,6 +52,7 @@ private:
     static inline const std::string _volumeParam = "volume";
     static inline const std::string _clippingParam = "clippingGeometry";
     static inline const std::string _lightParam = "light";
+    static inline const std::string _dynamicParam = "dynamicScene";
 
     template<typename HandleType, typename ComponentType>
     static std::vector<HandleType> _compileHandles(brayns::Components &components)
@@ -97,8 +103,9 @@ ospray::cpp::Group &Model::getHandle() noexcept
     return _handle;
 }
 
-Components &Model::getComponents() noexcept
+Components &Model::getComponents()
 {
+    _markModified();
     return _components;
 }
 
@@ -107,16 +114,38 @@ const Components &Model::getComponents() const noexcept
     return _components;
 }
 
-Systems &Model::getSystems() noexcept
+Systems &Model::getSystems()
 {
+    _markModified();
     return _systems;
 }
 
-SystemsView Model::getSystemsView() noexcept
+SystemsView Model::getSystemsView()
 {
+    _markModified();
     return SystemsView(_systems, _components);
 }
 
+ConstSystemsView Model::getSystemsView() const noexcept
+{
+    return ConstSystemsView(_systems, _components);
+}
+
+const Bounds &Model::getLocalBounds()
+{
+    if (!_localBounds)
+    {
+        auto view = ConstSystemsView(_systems, _components);
+        _localBounds = view.computeBounds(TransformMatrix());
+    }
+    return *_localBounds;
+}
+
+void Model::resetLocalBounds() noexcept
+{
+    _localBounds.reset();
+}
+
 void Model::init()
 {
     if (_systems._data)
@@ -128,6 +157,21 @@ void Model::init()
     _handle = GroupBuilder::build(_components);
 }
 
+void Model::update(const ParametersManager &parameters)
+{
+    if (!_systems._update)
+    {
+        return;
+    }
+
+    _systems._update->execute(parameters, _components);
+}
+
+bool Model::hasUpdateSystem() const noexcept
+{
+    return _systems._update != nullptr;
+}
+
 CommitResult Model::commit()
 {
     if (!_systems._data)
@@ -139,7 +183,19 @@ CommitResult Model::commit()
     if (result.needsRebuildBVH)
     {
         _handle.commit();
+        _localBounds.reset();
     }
     return result;
 }
+
+void Model::_markModified()
+{
+    // Mutable access can change the geometry, so the cached bounds cannot be trusted until recomputed
+    _localBounds.reset();
+
+    if (_dirtySet)
+    {
+        _dirtySet->addModel(*this);
+    }
+}
 } // namespace brayns
@@ -22,17 +22,25 @@
 #pragma once
 
 #include "Components.h"
+#include "ModelDirtySet.h"
 #include "Systems.h"
 #include "SystemsView.h"
 
+#include <brayns/engine/components/Bounds.h>
+
 #include <ospray/ospray_cpp/Group.h>
 
+#include <optional>
+
 namespace brayns
 {
 /**
  * @brief The Model class represents an isolate rendering unit in the engine. It is made up of
  * components, which adds functionality as well as renderable items, such as geometry, volumes and
  * clipping geometry.
+ *
+ * Once added to a scene, any mutable access to the components or systems flags the model to be committed on the
+ * next frame.
  */
 class Model
 {
@@ -67,10 +75,10 @@ public:
      * @brief Returns the model's component list
      * @return Components&
      */
-    Components &getComponents() noexcept;
+    Components &getComponents();
 
     /**
-     * @copydoc Model::getComponents() noexcept;
+     * @copydoc Model::getComponents()
      */
     const Components &getComponents() const noexcept;
 
@@ -78,13 +86,33 @@ public:
      * @brief Returns the model's systems manager
      * @return Systems&
      */
-    Systems &getSystems() noexcept;
+    Systems &getSystems();
 
     /**
      * @brief Returns a view to the systems
      * @return SystemsView
      */
-    SystemsView getSystemsView() noexcept;
+    SystemsView getSystemsView();
+
+    /**
+     * @brief Returns a read-only view to the systems, for queries (bounds, inspection) that must not flag the model
+     * to be committed.
+     * @return ConstSystemsView
+     */
+    ConstSystemsView getSystemsView() const noexcept;
+
+    /**
+     * @brief Returns the bounds of the model in its local space. Computed on first call and cached until the model
+     * components or systems are accessed mutably, its geometry is committed again or resetLocalBounds() is called.
+     * @return const Bounds&
+     */
+    const Bounds &getLocalBounds();
+
+    /**
+     * @brief Discards the cached local bounds, to be called when the model data has been modified and the bounds are
+     * needed before the next commit.
+     */
+    void resetLocalBounds() noexcept;
 
 private:
     /**
@@ -92,20 +120,37 @@ private:
      */
     void init();
 
+    /**
+     * @brief Calls the update system, if any. Does not flag the model as modified so it can be called concurrently on
+     * different models.
+     * @param parameters System parameters.
+     */
+    void update(const ParametersManager &parameters);
+
+    /**
+     * @brief Returns true if the model has an update system that must be called every frame.
+     */
+    bool hasUpdateSystem() const noexcept;
+
     /**
      * @brief Commits the model data to OSPRay
      * @return CommitResult Required actions after model commit.
      */
     CommitResult commit();
 
+    void _markModified();
+
 private:
     friend class ModelManager;
 
+    ModelDirtySet *_dirtySet = nullptr;
+
     uint32_t _id{};
     std::string _type;
     ospray::cpp::Group _handle;
 
     Components _components;
     Systems _systems;
+    std::optional<Bounds> _localBounds;
 };
 } // namespace brayns
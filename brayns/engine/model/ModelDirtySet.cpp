@@ -0,0 +1,93 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ModelDirtySet.h"
+
+#include <utility>
+
+namespace
+{
+class DirtySetExtractor
+{
+public:
+    template<typename T>
+    static std::vector<T *> take(std::unordered_set<T *> &objects)
+    {
+        auto result = std::vector<T *>(objects.begin(), objects.end());
+        objects.clear();
+        return result;
+    }
+};
+}
+
+namespace brayns
+{
+void ModelDirtySet::addModel(Model &model)
+{
+    _models.insert(&model);
+}
+
+void ModelDirtySet::addInstance(ModelInstance &instance)
+{
+    _instances.insert(&instance);
+}
+
+void ModelDirtySet::setHandlesModified() noexcept
+{
+    _handlesModified = true;
+}
+
+void ModelDirtySet::removeModel(Model &model)
+{
+    _models.erase(&model);
+}
+
+void ModelDirtySet::removeInstance(ModelInstance &instance)
+{
+    _instances.erase(&instance);
+}
+
+void ModelDirtySet::clear()
+{
+    _models.clear();
+    _instances.clear();
+    _handlesModified = true;
+}
+
+std::vector<Model *> ModelDirtySet::takeModels()
+{
+    return DirtySetExtractor::take(_models);
+}
+
+std::vector<ModelInstance *> ModelDirtySet::takeInstances()
+{
+    return DirtySetExtractor::take(_instances);
+}
+
+bool ModelDirtySet::takeHandlesModified() noexcept
+{
+    return std::exchange(_handlesModified, false);
+}
+
+bool ModelDirtySet::hasHandlesModified() const noexcept
+{
+    return _handlesModified;
+}
+}
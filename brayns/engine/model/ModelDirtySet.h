@@ -0,0 +1,101 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+namespace brayns
+{
+class Model;
+class ModelInstance;
+
+/**
+ * @brief Keeps track of the models and instances modified since the last commit, so that the scene commit cost
+ * depends on the number of changes instead of the number of instances.
+ */
+class ModelDirtySet
+{
+public:
+    /**
+     * @brief Flags a model to be committed.
+     * @param model Modified model.
+     */
+    void addModel(Model &model);
+
+    /**
+     * @brief Flags an instance to be committed.
+     * @param instance Modified instance.
+     */
+    void addInstance(ModelInstance &instance);
+
+    /**
+     * @brief Flags the list of visible instances as modified (instances added, removed, shown or hidden).
+     */
+    void setHandlesModified() noexcept;
+
+    /**
+     * @brief Forgets a model about to be destroyed.
+     * @param model Model to remove.
+     */
+    void removeModel(Model &model);
+
+    /**
+     * @brief Forgets an instance about to be destroyed.
+     * @param instance Instance to remove.
+     */
+    void removeInstance(ModelInstance &instance);
+
+    /**
+     * @brief Removes all the tracked objects.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the modified models and resets their tracking.
+     * @return std::vector<Model *>
+     */
+    std::vector<Model *> takeModels();
+
+    /**
+     * @brief Returns the modified instances and resets their tracking.
+     * @return std::vector<ModelInstance *>
+     */
+    std::vector<ModelInstance *> takeInstances();
+
+    /**
+     * @brief Returns true if the instance list has been modified and resets the flag.
+     * @return bool
+     */
+    bool takeHandlesModified() noexcept;
+
+    /**
+     * @brief Returns true if the instance list has been modified.
+     * @return bool
+     */
+    bool hasHandlesModified() const noexcept;
+
+private:
+    std::unordered_set<Model *> _models;
+    std::unordered_set<ModelInstance *> _instances;
+    bool _handlesModified = false;
+};
+}
@@ -23,12 +23,31 @@
 
 #include <ospray/ospray_cpp/ext/rkcommon.h>
 
+#include <utility>
+
 namespace
 {
 struct InstanceParameters
 {
     static inline const std::string transform = "transform";
 };
+
+class BoundsTransformer
+{
+public:
+    /**
+     * @brief Transforms the 8 corners of the local bounds, giving a conservative box of the transformed geometry.
+     */
+    static brayns::Bounds transform(const brayns::TransformMatrix &matrix, const brayns::Bounds &bounds)
+    {
+        auto &box = bounds.box;
+        if (box.empty())
+        {
+            return bounds;
+        }
+        return brayns::Bounds(matrix.transformBounds(box));
+    }
+};
 }
 
 namespace brayns
@@ -62,7 +81,8 @@ const Bounds &ModelInstance::getBounds() const noexcept
 
 void ModelInstance::computeBounds() noexcept
 {
-    auto view = _model->getSystemsView();
+    _model->resetLocalBounds();
+    auto view = std::as_const(*_model).getSystemsView();
     _bounds = view.computeBounds(_getFullTransform());
 }
 
@@ -86,9 +106,19 @@ ModelInfo ModelInstance::getModelData() const noexcept
     return ModelInfo(*_model);
 }
 
-void ModelInstance::setVisible(const bool val) noexcept
+void ModelInstance::setVisible(const bool val)
 {
-    _flag.update(_visible, val);
+    if (!_flag.update(_visible, val))
+    {
+        return;
+    }
+
+    _markModified();
+
+    if (_dirtySet)
+    {
+        _dirtySet->setHandlesModified();
+    }
 }
 
 bool ModelInstance::isVisible() const noexcept
@@ -96,13 +126,14 @@ bool ModelInstance::isVisible() const noexcept
     return _visible;
 }
 
-void ModelInstance::setTransform(const Transform &transform) noexcept
+void ModelInstance::setTransform(const Transform &transform)
 {
     if (_flag.update(_transform, transform))
     {
         auto matrix = _getFullTransform();
-        auto view = _model->getSystemsView();
-        _bounds = view.computeBounds(matrix);
+        auto &localBounds = _model->getLocalBounds();
+        _bounds = BoundsTransformer::transform(matrix, localBounds);
+        _markModified();
     }
 }
 
@@ -132,7 +163,8 @@ TransformMatrix ModelInstance::_getFullTransform() const noexcept
 {
     auto matrix = _transform.toMatrix();
 
-    auto &components = _model->getComponents();
+    auto &model = getModel();
+    auto &components = model.getComponents();
     auto baseTransform = components.find<Transform>();
     if (baseTransform)
     {
@@ -147,4 +179,12 @@ void ModelInstance::_updateTransform()
     auto matrix = _getFullTransform();
     _handle.setParam(InstanceParameters::transform, matrix.affine);
 }
+
+void ModelInstance::_markModified()
+{
+    if (_dirtySet)
+    {
+        _dirtySet->addInstance(*this);
+    }
+}
 }
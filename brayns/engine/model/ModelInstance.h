@@ -71,7 +71,8 @@ public:
     const Bounds &getBounds() const noexcept;
 
     /**
-     * @brief Recompute the model bounds with the current transform
+     * @brief Recompute the model bounds with the current transform from the model data. Transform changes only
+     * transform the cached model local bounds, which is faster but less tight with rotations.
      */
     void computeBounds() noexcept;
 
@@ -101,7 +102,7 @@ public:
     /**
      * @brief Sets wether this instance is visible or not.
      */
-    void setVisible(const bool val) noexcept;
+    void setVisible(const bool val);
 
     /**
      * @brief Returns wether this instance is visible or not.
@@ -111,7 +112,7 @@ public:
     /**
      * @brief Sets the transform of this instance.
      */
-    void setTransform(const Transform &transform) noexcept;
+    void setTransform(const Transform &transform);
 
     /**
      * @brief Returns the trasnsformation of this instance.
@@ -141,7 +142,14 @@ private:
      */
     void _updateTransform();
 
+    /**
+     * @brief Flags the instance to be committed on the next frame (if it belongs to a scene).
+     */
+    void _markModified();
+
 private:
+    friend class ModelManager;
+
     uint32_t _id;
     bool _visible = true;
     Transform _transform;
@@ -149,5 +157,6 @@ private:
     std::shared_ptr<Model> _model;
     ospray::cpp::Instance _handle;
     ModifiedFlag _flag;
+    ModelDirtySet *_dirtySet = nullptr;
 };
 }
@@ -66,6 +66,7 @@ public:
 
 private:
     friend class SystemsView;
+    friend class ConstSystemsView;
     friend class Model;
 
     std::unique_ptr<DataSystem> _data;
@@ -38,6 +38,11 @@ InspectResultData SystemsView::inspect(const InspectContext &context)
     return _systems->_inspect ? _systems->_inspect->execute(context, *_components) : InspectResultData();
 }
 
+uint64_t SystemsView::getInspectedElementId(const InspectContext &context)
+{
+    return _systems->_inspect ? _systems->_inspect->getElementId(context, *_components) : context.primitiveIndex;
+}
+
 Bounds SystemsView::computeBounds(const TransformMatrix &matrix)
 {
     return _systems->_bounds ? _systems->_bounds->compute(matrix, *_components) : Bounds();
@@ -57,4 +62,30 @@ void SystemsView::applyColor(const std::string &method, const ColorMethodInput &
 {
     _systems->_color ? _systems->_color->apply(method, input, *_components) : void();
 }
+
+ConstSystemsView::ConstSystemsView(const Systems &systems, const Components &components):
+    _systems(&systems),
+    _components(&components)
+{
+}
+
+InspectResultData ConstSystemsView::inspect(const InspectContext &context) const
+{
+    return _systems->_inspect ? _systems->_inspect->execute(context, *_components) : InspectResultData();
+}
+
+uint64_t ConstSystemsView::getInspectedElementId(const InspectContext &context) const
+{
+    return _systems->_inspect ? _systems->_inspect->getElementId(context, *_components) : context.primitiveIndex;
+}
+
+Bounds ConstSystemsView::computeBounds(const TransformMatrix &matrix) const
+{
+    return _systems->_bounds ? _systems->_bounds->compute(matrix, *_components) : Bounds();
+}
+
+std::vector<std::string> ConstSystemsView::getColorMethods() const
+{
+    return _systems->_color ? _systems->_color->getMethods() : std::vector<std::string>();
+}
 }
@@ -32,6 +32,7 @@ public:
 
     void update(const ParametersManager &parameters);
     InspectResultData inspect(const InspectContext &context);
+    uint64_t getInspectedElementId(const InspectContext &context);
     Bounds computeBounds(const TransformMatrix &matrix);
     std::vector<std::string> getColorMethods() const;
     std::vector<std::string> getColorValues(const std::string &method) const;
@@ -41,4 +42,22 @@ private:
     Systems *_systems;
     Components *_components;
 };
+
+/**
+ * @brief Read-only access to the systems queries, which does not flag the model as modified.
+ */
+class ConstSystemsView
+{
+public:
+    ConstSystemsView(const Systems &systems, const Components &components);
+
+    InspectResultData inspect(const InspectContext &context) const;
+    uint64_t getInspectedElementId(const InspectContext &context) const;
+    Bounds computeBounds(const TransformMatrix &matrix) const;
+    std::vector<std::string> getColorMethods() const;
+
+private:
+    const Systems *_systems;
+    const Components *_components;
+};
 }
@@ -31,6 +31,16 @@ class InspectSystem
 public:
     virtual ~InspectSystem() = default;
 
-    virtual InspectResultData execute(const InspectContext &context, Components &components) = 0;
+    virtual InspectResultData execute(const InspectContext &context, const Components &components) = 0;
+
+    /**
+     * @brief Returns a numeric identifier of the element hit (cell ID for example), used by batch inspection.
+     * Defaults to the index of the primitive hit.
+     */
+    virtual uint64_t getElementId(const InspectContext &context, const Components &components)
+    {
+        (void)components;
+        return context.primitiveIndex;
+    }
 };
 }
@@ -0,0 +1,145 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ModelInstanceStore.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+class SlotFinder
+{
+public:
+    static size_t find(const std::unordered_map<uint32_t, size_t> &slots, uint32_t id)
+    {
+        auto it = slots.find(id);
+        if (it == slots.end())
+        {
+            throw std::invalid_argument("No instance with id " + std::to_string(id) + " was found");
+        }
+        return it->second;
+    }
+};
+
+class InstanceCompactor
+{
+public:
+    static void compact(
+        std::vector<std::unique_ptr<brayns::ModelInstance>> &instances,
+        std::unordered_map<uint32_t, size_t> &slots)
+    {
+        size_t count = 0;
+
+        for (size_t i = 0; i < instances.size(); ++i)
+        {
+            auto &instance = instances[i];
+
+            if (!instance)
+            {
+                continue;
+            }
+
+            if (i != count)
+            {
+                slots[instance->getID()] = count;
+                instances[count] = std::move(instance);
+            }
+
+            ++count;
+        }
+
+        instances.resize(count);
+    }
+};
+}
+
+namespace brayns
+{
+ModelInstance &ModelInstanceStore::add(std::unique_ptr<ModelInstance> instance)
+{
+    auto id = instance->getID();
+    auto [it, inserted] = _slots.emplace(id, _instances.size());
+
+    if (!inserted)
+    {
+        throw std::invalid_argument("Duplicated instance id " + std::to_string(id));
+    }
+
+    return *_instances.emplace_back(std::move(instance));
+}
+
+void ModelInstanceStore::reserve(size_t count)
+{
+    _instances.reserve(count);
+    _slots.reserve(count);
+}
+
+ModelInstance &ModelInstanceStore::get(uint32_t id) const
+{
+    auto slot = SlotFinder::find(_slots, id);
+    return *_instances[slot];
+}
+
+bool ModelInstanceStore::contains(uint32_t id) const noexcept
+{
+    return _slots.find(id) != _slots.end();
+}
+
+const std::vector<std::unique_ptr<ModelInstance>> &ModelInstanceStore::getAll() const noexcept
+{
+    return _instances;
+}
+
+std::vector<std::unique_ptr<ModelInstance>> ModelInstanceStore::remove(const std::vector<uint32_t> &ids)
+{
+    for (auto id : ids)
+    {
+        SlotFinder::find(_slots, id);
+    }
+
+    auto removed = std::vector<std::unique_ptr<ModelInstance>>();
+    removed.reserve(ids.size());
+
+    for (auto id : ids)
+    {
+        auto it = _slots.find(id);
+        if (it == _slots.end())
+        {
+            continue;
+        }
+        removed.push_back(std::move(_instances[it->second]));
+        _slots.erase(it);
+    }
+
+    if (!removed.empty())
+    {
+        InstanceCompactor::compact(_instances, _slots);
+    }
+
+    return removed;
+}
+
+void ModelInstanceStore::clear() noexcept
+{
+    _instances.clear();
+    _slots.clear();
+}
+}
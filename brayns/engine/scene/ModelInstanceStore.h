@@ -0,0 +1,92 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/engine/model/ModelInstance.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace brayns
+{
+/**
+ * @brief Contiguous list of model instances indexed by instance ID.
+ *
+ * Lookups by ID are O(1) and removing a batch of instances is done in a single pass over the list, keeping the
+ * insertion order. Instances are heap allocated so their address remains valid until they are removed.
+ */
+class ModelInstanceStore
+{
+public:
+    /**
+     * @brief Adds a new instance to the store.
+     * @param instance Instance to add, its ID must not be in the store already.
+     * @return ModelInstance& Added instance.
+     * @throws std::invalid_argument if the instance ID is already in the store.
+     */
+    ModelInstance &add(std::unique_ptr<ModelInstance> instance);
+
+    /**
+     * @brief Reserves storage for the given number of instances.
+     * @param count Total number of instances.
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Returns the instance identified by the given ID.
+     * @param id Instance ID.
+     * @return ModelInstance&
+     * @throws std::invalid_argument if no instance has the given ID.
+     */
+    ModelInstance &get(uint32_t id) const;
+
+    /**
+     * @brief Checks wether an instance with the given ID exists.
+     * @param id Instance ID.
+     * @return bool
+     */
+    bool contains(uint32_t id) const noexcept;
+
+    /**
+     * @brief Returns all the instances in insertion order.
+     * @return const std::vector<std::unique_ptr<ModelInstance>>&
+     */
+    const std::vector<std::unique_ptr<ModelInstance>> &getAll() const noexcept;
+
+    /**
+     * @brief Removes the instances with the given IDs. Duplicated IDs are ignored.
+     * @param ids IDs of the instances to remove.
+     * @return std::vector<std::unique_ptr<ModelInstance>> Removed instances.
+     * @throws std::invalid_argument if any of the IDs does not exist, in which case nothing is removed.
+     */
+    std::vector<std::unique_ptr<ModelInstance>> remove(const std::vector<uint32_t> &ids);
+
+    /**
+     * @brief Removes all instances.
+     */
+    void clear() noexcept;
+
+private:
+    std::vector<std::unique_ptr<ModelInstance>> _instances;
+    std::unordered_map<uint32_t, size_t> _slots;
+};
+}
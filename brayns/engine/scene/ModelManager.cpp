@@ -20,32 +20,44 @@
 
 #include "ModelManager.h"
 
-#include <utility>
+#include <algorithm>
+#include <exception>
 
 namespace
 {
-class InstanceFinder
+class ParallelModelExecutor
 {
 public:
-    template<typename Container>
-    static auto findIterator(Container &instances, uint32_t instanceId)
+    /**
+     * @brief Calls callable(index, model) for each model on the OpenMP thread pool. If any call throws, the exception
+     * of the model with the lowest index is rethrown once all calls are done.
+     */
+    template<typename Callable>
+    static void execute(const std::vector<brayns::Model *> &models, Callable &&callable)
     {
-        auto begin = instances.begin();
-        auto end = instances.end();
-        auto it = std::find_if(begin, end, [mId = instanceId](auto &instance) { return instance->getID() == mId; });
+        auto errors = std::vector<std::exception_ptr>(models.size());
 
-        if (it == instances.end())
+        // A single model runs inline so its own parallel loops are not nested in an active region.
+#pragma omp parallel for schedule(dynamic, 1) if (models.size() > 1)
+        for (size_t i = 0; i < models.size(); ++i)
         {
-            throw std::invalid_argument("No instance with id " + std::to_string(instanceId) + " was found");
+            try
+            {
+                callable(i, *models[i]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
         }
 
-        return it;
-    }
-
-    template<typename Container>
-    static auto &find(Container &instances, uint32_t instanceId)
-    {
-        return **findIterator(instances, instanceId);
+        for (auto &error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
     }
 };
 }
@@ -56,10 +68,7 @@ ModelInstance *ModelManager::add(std::shared_ptr<Model> model)
 {
     model->init();
     auto instanceId = _instanceIdFactory.generateID();
-    auto instance = std::make_unique<ModelInstance>(instanceId, std::move(model));
-    _instances.push_back(std::move(instance));
-    _dirty = true;
-    return _instances.back().get();
+    return _addInstance(std::make_unique<ModelInstance>(instanceId, std::move(model)));
 }
 
 std::vector<ModelInstance *> ModelManager::add(std::vector<std::shared_ptr<Model>> models)
@@ -77,9 +86,9 @@ std::vector<ModelInstance *> ModelManager::add(std::vector<std::shared_ptr<Model
 
 std::vector<ModelInstance *> ModelManager::createInstances(uint32_t instanceId, size_t count)
 {
-    auto &sourceInstance = InstanceFinder::find(_instances, instanceId);
+    auto &sourceInstance = _instances.get(instanceId);
 
-    _instances.reserve(_instances.size() + count);
+    _instances.reserve(_instances.getAll().size() + count);
 
     auto result = std::vector<ModelInstance *>();
     result.reserve(count);
@@ -87,8 +96,7 @@ std::vector<ModelInstance *> ModelManager::createInstances(uint32_t instanceId,
     for (size_t i = 0; i < count; ++i)
     {
         auto instanceId = _instanceIdFactory.generateID();
-        _instances.push_back(std::make_unique<ModelInstance>(instanceId, sourceInstance));
-        result.push_back(_instances.back().get());
+        result.push_back(_addInstance(std::make_unique<ModelInstance>(instanceId, sourceInstance)));
     }
 
     return result;
@@ -96,12 +104,22 @@ std::vector<ModelInstance *> ModelManager::createInstances(uint32_t instanceId,
 
 ModelInstance &ModelManager::getModelInstance(uint32_t modelID)
 {
-    return InstanceFinder::find(_instances, modelID);
+    return _instances.get(modelID);
+}
+
+ModelInstance *ModelManager::findModelInstance(const ospray::cpp::Instance &handle) const noexcept
+{
+    auto it = _handleInstances.find(handle.handle());
+    if (it == _handleInstances.end())
+    {
+        return nullptr;
+    }
+    return it->second;
 }
 
 const std::vector<std::unique_ptr<ModelInstance>> &ModelManager::getAllModelInstances() const noexcept
 {
-    return _instances;
+    return _instances.getAll();
 }
 
 void ModelManager::removeModelInstancesById(const std::vector<uint32_t> &instanceIDs)
@@ -111,42 +129,51 @@ void ModelManager::removeModelInstancesById(const std::vector<uint32_t> &instanc
         return;
     }
 
-    for (auto instanceId : instanceIDs)
-    {
-        InstanceFinder::findIterator(_instances, instanceId);
-    }
-
     _removeModelInstances(instanceIDs);
 }
 
 void ModelManager::removeAllModelInstances()
 {
+    for (auto &[model, count] : _models)
+    {
+        model->_dirtySet = nullptr;
+    }
+
     _instanceIdFactory.clear();
     _instances.clear();
-    _dirty = true;
+    _handleInstances.clear();
+    _models.clear();
+    _updatableModels.clear();
+    _dirtySet.clear();
 }
 
 void ModelManager::update(const ParametersManager &parameters)
 {
-    for (auto &instance : _instances)
+    ParallelModelExecutor::execute(_updatableModels, [&](size_t, Model &model) { model.update(parameters); });
+
+    for (auto model : _updatableModels)
     {
-        auto &model = instance->getModel();
-        auto view = model.getSystemsView();
-        view.update(parameters);
+        _dirtySet.addModel(*model);
     }
 }
 
 CommitResult ModelManager::commit()
 {
-    auto result = CommitResult{std::exchange(_dirty, false)};
+    auto result = CommitResult{_dirtySet.hasHandlesModified()};
+
+    auto models = _dirtySet.takeModels();
+    auto modelResults = std::vector<CommitResult>(models.size());
 
-    for (auto &instance : _instances)
+    ParallelModelExecutor::execute(models, [&](size_t i, Model &model) { modelResults[i] = model.commit(); });
+
+    for (auto &modelResult : modelResults)
     {
-        auto &model = instance->getModel();
-        auto modelResult = model.commit();
         result.needsRebuildBVH |= modelResult.needsRebuildBVH;
         result.needsRender |= modelResult.needsRender;
+    }
 
+    for (auto instance : _dirtySet.takeInstances())
+    {
         auto instanceResult = instance->commit();
         result.needsRebuildBVH |= instanceResult;
     }
@@ -158,7 +185,7 @@ Bounds ModelManager::getBounds() const noexcept
 {
     Bounds result;
 
-    for (auto &instance : _instances)
+    for (auto &instance : _instances.getAll())
     {
         result.expand(instance->getBounds());
     }
@@ -168,10 +195,12 @@ Bounds ModelManager::getBounds() const noexcept
 
 std::vector<ospray::cpp::Instance> ModelManager::getHandles() noexcept
 {
+    auto &instances = _instances.getAll();
+
     std::vector<ospray::cpp::Instance> handles;
-    handles.reserve(_instances.size());
+    handles.reserve(instances.size());
 
-    for (auto &instance : _instances)
+    for (auto &instance : instances)
     {
         if (!instance->isVisible())
         {
@@ -183,15 +212,80 @@ std::vector<ospray::cpp::Instance> ModelManager::getHandles() noexcept
     return handles;
 }
 
+std::optional<std::vector<ospray::cpp::Instance>> ModelManager::getModifiedHandles()
+{
+    if (!_dirtySet.takeHandlesModified())
+    {
+        return std::nullopt;
+    }
+    return getHandles();
+}
+
 void ModelManager::_removeModelInstances(const std::vector<uint32_t> &ids)
 {
-    for (auto id : ids)
+    auto removed = _instances.remove(ids);
+
+    if (removed.empty())
+    {
+        return;
+    }
+
+    for (auto &instance : removed)
+    {
+        _untrack(*instance);
+        _instanceIdFactory.releaseID(instance->getID());
+    }
+
+    _dirtySet.setHandlesModified();
+}
+
+ModelInstance *ModelManager::_addInstance(std::unique_ptr<ModelInstance> instance)
+{
+    auto &result = _instances.add(std::move(instance));
+    _track(result);
+    return &result;
+}
+
+void ModelManager::_track(ModelInstance &instance)
+{
+    instance._dirtySet = &_dirtySet;
+    _handleInstances[instance.getHandle().handle()] = &instance;
+    _dirtySet.addInstance(instance);
+    _dirtySet.setHandlesModified();
+
+    auto &model = instance.getModel();
+    auto &count = _models[&model];
+
+    if (count++ != 0)
+    {
+        return;
+    }
+
+    model._dirtySet = &_dirtySet;
+    _dirtySet.addModel(model);
+
+    if (model.hasUpdateSystem())
+    {
+        _updatableModels.push_back(&model);
+    }
+}
+
+void ModelManager::_untrack(ModelInstance &instance)
+{
+    _dirtySet.removeInstance(instance);
+    _handleInstances.erase(instance.getHandle().handle());
+
+    auto &model = instance.getModel();
+    auto it = _models.find(&model);
+
+    if (--it->second != 0)
     {
-        auto it = InstanceFinder::findIterator(_instances, id);
-        _instances.erase(it);
-        _instanceIdFactory.releaseID(id);
+        return;
     }
 
-    _dirty = true;
+    _models.erase(it);
+    model._dirtySet = nullptr;
+    _dirtySet.removeModel(model);
+    std::erase(_updatableModels, &model);
 }
 }
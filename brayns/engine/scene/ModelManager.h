@@ -21,16 +21,23 @@
 #pragma once
 
 #include <brayns/engine/model/Model.h>
+#include <brayns/engine/model/ModelDirtySet.h>
 #include <brayns/engine/model/ModelInstance.h>
 #include <brayns/utils/IDFactory.h>
 
+#include "ModelInstanceStore.h"
+
 #include <memory>
-#include <unordered_set>
+#include <optional>
+#include <unordered_map>
 
 namespace brayns
 {
 /**
- * @brief The SceneModelManager class manages models within a scene
+ * @brief The SceneModelManager class manages models within a scene.
+ *
+ * Only the models and instances modified since the last commit are committed, and the list of instance handles is
+ * only rebuilt when instances are added, removed, shown or hidden.
  */
 class ModelManager
 {
@@ -65,6 +72,13 @@ public:
      */
     ModelInstance &getModelInstance(uint32_t instanceID);
 
+    /**
+     * @brief Returns the model instance owning the given OSPRay instance handle (from a pick result for example).
+     * @param handle OSPRay instance handle.
+     * @return ModelInstance* or null if the handle does not belong to any instance of the manager.
+     */
+    ModelInstance *findModelInstance(const ospray::cpp::Instance &handle) const noexcept;
+
     /**
      * @brief Return a list of all model instances in the manager
      * @return std::vector<ModelInstance *> &
@@ -80,10 +94,12 @@ public:
     template<typename Callable>
     void removeModelInstances(Callable &&callable)
     {
+        auto &instances = _instances.getAll();
+
         auto ids = std::vector<uint32_t>();
-        ids.reserve(_instances.size());
+        ids.reserve(instances.size());
 
-        for (const auto &instance : _instances)
+        for (const auto &instance : instances)
         {
             if (!callable(*instance))
             {
@@ -96,7 +112,7 @@ public:
     }
 
     /**
-     * @brief Removes selected models from the manager.
+     * @brief Removes selected models from the manager in a single pass.
      * @param ids List of model instance Ids to remove.
      * @throws std::invalid_argument if any of the given ids does not exists, in which case no instance is removed.
      */
@@ -111,13 +127,14 @@ private:
     friend class Scene;
 
     /**
-     * @brief Calls the update system of all models
+     * @brief Calls the update system of all models that have one, in parallel
      * @param parameters
      */
     void update(const ParametersManager &parameters);
 
     /**
-     * @brief Attempts to commit any unsynced data to Ospray.
+     * @brief Commits the models and instances modified since the last commit to Ospray. Models are committed in
+     * parallel.
      * @return CommitResult information about the result of the commit
      */
     CommitResult commit();
@@ -134,12 +151,25 @@ private:
      */
     std::vector<ospray::cpp::Instance> getHandles() noexcept;
 
+    /**
+     * @brief Return the list of ospray instance handles if it changed since the last call
+     * @return std::optional<std::vector<ospray::cpp::Instance>>
+     */
+    std::optional<std::vector<ospray::cpp::Instance>> getModifiedHandles();
+
 private:
     void _removeModelInstances(const std::vector<uint32_t> &ids);
+    ModelInstance *_addInstance(std::unique_ptr<ModelInstance> instance);
+    void _track(ModelInstance &instance);
+    void _untrack(ModelInstance &instance);
 
 private:
     IDFactory<uint32_t> _instanceIdFactory;
-    std::vector<std::unique_ptr<ModelInstance>> _instances;
-    bool _dirty = false;
+    ModelInstanceStore _instances;
+    std::unordered_map<OSPInstance, ModelInstance *> _handleInstances;
+    // Number of instances using each model
+    std::unordered_map<Model *, size_t> _models;
+    std::vector<Model *> _updatableModels;
+    ModelDirtySet _dirtySet;
 };
 }
@@ -61,9 +61,13 @@ bool Scene::commit()
 {
     auto modelCommitResult = _models.commit();
 
+    if (auto handles = _models.getModifiedHandles())
+    {
+        WorldInstances::set(_handle, *handles);
+    }
+
     if (modelCommitResult.needsRebuildBVH)
     {
-        WorldInstances::set(_handle, _models.getHandles());
         _handle.commit();
     }
 
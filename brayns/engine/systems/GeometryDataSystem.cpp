@@ -75,6 +75,22 @@ private:
     }
 };
 
+class ParallelCommitter
+{
+public:
+    template<typename T>
+    static void commit(std::vector<T> &elements)
+    {
+        auto count = elements.size();
+
+#pragma omp parallel for schedule(dynamic, 64) if (count > 64)
+        for (size_t i = 0; i < count; ++i)
+        {
+            elements[i].commit();
+        }
+    }
+};
+
 class GeometryCommitter
 {
 public:
@@ -99,10 +115,7 @@ public:
         }
 
         geometries.modified.setModified(false);
-        for (auto &geometry : geometries.elements)
-        {
-            geometry.commit();
-        }
+        ParallelCommitter::commit(geometries.elements);
         return true;
     }
 
@@ -114,10 +127,7 @@ public:
         }
 
         views.modified.setModified(false);
-        for (auto &view : views.elements)
-        {
-            view.commit();
-        }
+        ParallelCommitter::commit(views.elements);
         return true;
     }
 };
@@ -49,10 +49,12 @@
 #include <brayns/network/entrypoints/FramebufferEntrypoint.h>
 #include <brayns/network/entrypoints/GetLoadersEntrypoint.h>
 #include <brayns/network/entrypoints/GetModelEntrypoint.h>
+#include <brayns/network/entrypoints/InspectBatchEntrypoint.h>
 #include <brayns/network/entrypoints/InspectEntrypoint.h>
 #include <brayns/network/entrypoints/InstantiateModelEntrypoint.h>
 #include <brayns/network/entrypoints/MaterialEntrypoint.h>
 #include <brayns/network/entrypoints/ModelColoringEntrypoint.h>
+#include <brayns/network/entrypoints/PlaySimulationEntrypoint.h>
 #include <brayns/network/entrypoints/QuitEntrypoint.h>
 #include <brayns/network/entrypoints/RegistryEntrypoint.h>
 #include <brayns/network/entrypoints/RemoveModelEntrypoint.h>
@@ -62,6 +64,7 @@
 #include <brayns/network/entrypoints/SchemaEntrypoint.h>
 #include <brayns/network/entrypoints/SimulationParametersEntrypoint.h>
 #include <brayns/network/entrypoints/SnapshotEntrypoint.h>
+#include <brayns/network/entrypoints/SnapshotSequenceEntrypoint.h>
 #include <brayns/network/entrypoints/UpdateModelEntrypoint.h>
 #include <brayns/network/entrypoints/UploadModelEntrypoint.h>
 #include <brayns/network/entrypoints/VersionEntrypoint.h>
@@ -88,6 +91,7 @@ public:
         auto &loaders = api.getLoaderRegistry();
 
         brayns::CancellationToken token(interface);
+        auto playback = std::make_shared<brayns::SimulationPlayback>();
         brayns::EntrypointBuilder builder("Core", interface);
 
         builder.add<brayns::AddBoundedPlanesEntrypoint>(models);
@@ -113,6 +117,7 @@ public:
         builder.add<brayns::ClearModelsEntrypoint>(models, simulation);
         builder.add<brayns::ClearRenderablesEntrypoint>(models, simulation);
         builder.add<brayns::ColorModelEntrypoint>(models);
+        builder.add<brayns::ControlSimulationPlaybackEntrypoint>(playback);
         builder.add<brayns::EnableSimulationEntrypoint>(models);
         builder.add<brayns::ExportGBuffersEntrypoint>(engine, token);
         builder.add<brayns::GetApplicationParametersEntrypoint>(application);
@@ -142,8 +147,10 @@ public:
         builder.add<brayns::GetRendererTypeEntrypoint>(engine);
         builder.add<brayns::GetSceneEntrypoint>(scene);
         builder.add<brayns::GetSimulationParametersEntrypoint>(simulation);
+        builder.add<brayns::InspectBatchEntrypoint>(engine);
         builder.add<brayns::InspectEntrypoint>(engine);
         builder.add<brayns::InstantiateModelEntrypoint>(models);
+        builder.add<brayns::PlaySimulationEntrypoint>(engine, simulation, playback, token);
         builder.add<brayns::QuitEntrypoint>(interface);
         builder.add<brayns::RegistryEntrypoint>(entrypoints);
         builder.add<brayns::RemoveModelEntrypoint>(models, simulation);
@@ -171,6 +178,7 @@ public:
         builder.add<brayns::SetSimulationParametersEntrypoint>(simulation);
         builder.add<brayns::SetStaticFramebufferEntrypoint>(engine);
         builder.add<brayns::SnapshotEntrypoint>(engine, token);
+        builder.add<brayns::SnapshotSequenceEntrypoint>(engine, token);
         builder.add<brayns::UpdateModelEntrypoint>(models);
         builder.add<brayns::UploadModelEntrypoint>(models, loaders, simulation, token);
         builder.add<brayns::VersionEntrypoint>();
@@ -259,7 +267,8 @@ public:
 
 namespace brayns
 {
-NetworkManager::NetworkManager(PluginAPI &api)
+NetworkManager::NetworkManager(PluginAPI &api):
+    _engine(api.getEngine())
 {
     auto listener = std::make_unique<SocketListener>(_monitor);
     _socket = SocketFactory::createSocket(api, std::move(listener));
@@ -274,6 +283,7 @@ void NetworkManager::run()
     {
         Log::debug("Waiting for incoming messages.");
         auto buffer = _monitor.wait();
+        auto lock = _engine.lock();
         Log::debug("Processing received messages.");
         NetworkReceiver::receive(buffer, _clients, _entrypoints, _tasks);
         Log::debug("Running all registered tasks.");
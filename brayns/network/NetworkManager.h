@@ -74,6 +74,7 @@ public:
     virtual void stop() override;
 
 private:
+    Engine &_engine;
     std::unique_ptr<ISocket> _socket;
     ClientManager _clients;
     EntrypointRegistry _entrypoints;
@@ -0,0 +1,64 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/engine/core/RenderJob.h>
+
+#include "ProgressHandler.h"
+
+namespace brayns
+{
+/**
+ * @brief Helper class to wait for a render job while notifying its progress.
+ *
+ */
+class RenderProgress
+{
+public:
+    /**
+     * @brief Wait for the job to finish, notifying progress and polling cancellation every period.
+     *
+     * The function returns as soon as the frame is finished. If the request is cancelled, the exception is propagated
+     * and the frame is cancelled when the job is destroyed.
+     *
+     * @tparam RequestType Type of request to monitor.
+     * @param job Job to wait.
+     * @param progress Progress handler of the request.
+     * @param operation Current operation description.
+     * @param period Delay between two notifications.
+     * @throw TaskCancelledException Request has been cancelled.
+     */
+    template<typename RequestType>
+    static void wait(
+        const RenderJob &job,
+        const ProgressHandler<RequestType> &progress,
+        const std::string &operation,
+        std::chrono::milliseconds period)
+    {
+        progress.notify(operation, 0.0);
+        while (!job.waitFor(period))
+        {
+            progress.notify(operation, job.getProgress());
+        }
+    }
+};
+} // namespace brayns
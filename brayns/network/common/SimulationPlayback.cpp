@@ -0,0 +1,153 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "SimulationPlayback.h"
+
+#include <cmath>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <brayns/network/jsonrpc/JsonRpcException.h>
+
+namespace
+{
+class SpeedValidator
+{
+public:
+    static void validate(double speed)
+    {
+        if (!std::isfinite(speed) || speed == 0.0)
+        {
+            throw brayns::InvalidParamsException(fmt::format("Invalid playback speed: {}", speed));
+        }
+    }
+};
+} // namespace
+
+namespace brayns
+{
+void SimulationPlayback::start(uint32_t startFrame, uint32_t endFrame, double speed, bool loop)
+{
+    if (startFrame > endFrame)
+    {
+        throw InvalidParamsException(fmt::format("Invalid playback range: [{}, {}]", startFrame, endFrame));
+    }
+    SpeedValidator::validate(speed);
+    _playing = true;
+    _paused = false;
+    _loop = loop;
+    _startFrame = startFrame;
+    _endFrame = endFrame;
+    _speed = speed;
+    _seeking = false;
+    _position = speed > 0.0 ? startFrame : endFrame;
+}
+
+void SimulationPlayback::stop()
+{
+    _playing = false;
+    _paused = false;
+}
+
+bool SimulationPlayback::isPlaying() const
+{
+    return _playing;
+}
+
+bool SimulationPlayback::isPaused() const
+{
+    return _paused;
+}
+
+void SimulationPlayback::setPaused(bool paused)
+{
+    _paused = paused;
+}
+
+double SimulationPlayback::getSpeed() const
+{
+    return _speed;
+}
+
+void SimulationPlayback::setSpeed(double speed)
+{
+    SpeedValidator::validate(speed);
+    _speed = speed;
+}
+
+uint32_t SimulationPlayback::getStartFrame() const
+{
+    return _startFrame;
+}
+
+uint32_t SimulationPlayback::getEndFrame() const
+{
+    return _endFrame;
+}
+
+uint32_t SimulationPlayback::getFrame() const
+{
+    return static_cast<uint32_t>(std::floor(_position));
+}
+
+void SimulationPlayback::seek(uint32_t frame)
+{
+    if (frame < _startFrame || frame > _endFrame)
+    {
+        auto message = fmt::format("Frame {} out of playback range [{}, {}]", frame, _startFrame, _endFrame);
+        throw InvalidParamsException(message);
+    }
+    _position = frame;
+    _seeking = true;
+}
+
+bool SimulationPlayback::advance()
+{
+    if (_seeking)
+    {
+        _seeking = false;
+        return true;
+    }
+    auto start = static_cast<double>(_startFrame);
+    auto count = static_cast<double>(_endFrame) - start + 1.0;
+    auto position = _position + _speed;
+    if (position >= start && position < start + count)
+    {
+        _position = position;
+        return true;
+    }
+    if (!_loop)
+    {
+        return false;
+    }
+    auto offset = std::fmod(position - start, count);
+    if (offset < 0.0)
+    {
+        offset += count;
+    }
+    if (offset >= count)
+    {
+        offset = 0.0;
+    }
+    _position = start + offset;
+    return true;
+}
+} // namespace brayns
@@ -0,0 +1,144 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace brayns
+{
+/**
+ * @brief Playback state of the simulation streamed by play-simulation.
+ *
+ * Shared between the playback loop and the control entrypoint, both running on
+ * the network thread (controls are priority requests processed when the loop
+ * polls the network).
+ *
+ * The position is stored as a fractional frame so speeds below one frame per
+ * step slow down the simulation instead of being rounded to zero.
+ *
+ */
+class SimulationPlayback
+{
+public:
+    /**
+     * @brief Start a playback in the given frame range (inclusive).
+     *
+     * @param startFrame First frame of the playback.
+     * @param endFrame Last frame of the playback.
+     * @param speed Simulation frames advanced per step (negative to rewind).
+     * @param loop Restart from the other end once the range is exhausted.
+     * @throw InvalidParamsException Invalid range or speed.
+     */
+    void start(uint32_t startFrame, uint32_t endFrame, double speed, bool loop);
+
+    /**
+     * @brief Stop the current playback.
+     *
+     */
+    void stop();
+
+    /**
+     * @brief Check if a playback is running.
+     *
+     * @return true Playback running.
+     */
+    bool isPlaying() const;
+
+    /**
+     * @brief Check if the playback is paused.
+     *
+     * @return true Playback paused.
+     */
+    bool isPaused() const;
+
+    /**
+     * @brief Pause or resume the playback.
+     *
+     * @param paused True to pause, false to resume.
+     */
+    void setPaused(bool paused);
+
+    /**
+     * @brief Get the simulation frames advanced per step.
+     *
+     * @return double Playback speed.
+     */
+    double getSpeed() const;
+
+    /**
+     * @brief Change the simulation frames advanced per step.
+     *
+     * @param speed New speed, must be finite and non zero.
+     * @throw InvalidParamsException Invalid speed.
+     */
+    void setSpeed(double speed);
+
+    /**
+     * @brief Get the first frame of the playback.
+     *
+     * @return uint32_t Start frame.
+     */
+    uint32_t getStartFrame() const;
+
+    /**
+     * @brief Get the last frame of the playback.
+     *
+     * @return uint32_t End frame.
+     */
+    uint32_t getEndFrame() const;
+
+    /**
+     * @brief Get the simulation frame of the current step.
+     *
+     * @return uint32_t Current frame.
+     */
+    uint32_t getFrame() const;
+
+    /**
+     * @brief Jump to the given frame, the next step will render it.
+     *
+     * The next call to advance() will keep the position to this frame.
+     *
+     * @param frame Frame to seek.
+     * @throw InvalidParamsException Frame out of playback range.
+     */
+    void seek(uint32_t frame);
+
+    /**
+     * @brief Move to the next step, or to the frame seeked since last step.
+     *
+     * @return true Next frame is available.
+     * @return false Playback reached the end of the range without looping.
+     */
+    bool advance();
+
+private:
+    bool _playing = false;
+    bool _paused = false;
+    bool _loop = false;
+    bool _seeking = false;
+    uint32_t _startFrame = 0;
+    uint32_t _endFrame = 0;
+    double _position = 0.0;
+    double _speed = 1.0;
+};
+} // namespace brayns
@@ -0,0 +1,63 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "SnapshotSequence.h"
+
+#include <algorithm>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <brayns/network/jsonrpc/JsonRpcException.h>
+
+namespace brayns
+{
+void SnapshotSequence::validate(const SnapshotSequenceParams &params, const SimulationParameters &simulation)
+{
+    auto viewCount = params.camera_views.size();
+    auto frameCount = params.simulation_frames.size();
+
+    if (viewCount == 0 && frameCount == 0)
+    {
+        throw InvalidParamsException("At least one camera view or simulation frame is required");
+    }
+
+    if (viewCount != 0 && frameCount != 0 && viewCount != frameCount)
+    {
+        throw InvalidParamsException("Camera views and simulation frames must have the same size");
+    }
+
+    auto start = simulation.getStartFrame();
+    auto end = simulation.getEndFrame();
+
+    for (auto frame : params.simulation_frames)
+    {
+        if (frame < start || frame > end)
+        {
+            throw InvalidParamsException(fmt::format("Simulation frame {} out of range", frame));
+        }
+    }
+}
+
+size_t SnapshotSequence::getLength(const SnapshotSequenceParams &params)
+{
+    return std::max(params.camera_views.size(), params.simulation_frames.size());
+}
+} // namespace brayns
@@ -0,0 +1,55 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/network/messages/SnapshotSequenceMessage.h>
+#include <brayns/parameters/SimulationParameters.h>
+
+namespace brayns
+{
+/**
+ * @brief Helpers to check and size the frames of a snapshot-sequence request.
+ *
+ */
+class SnapshotSequence
+{
+public:
+    /**
+     * @brief Check that the sequence has frames and that its camera views and
+     * simulation frames are consistent.
+     *
+     * @param params Sequence parameters.
+     * @param simulation Simulation of the scene, to check the frame range.
+     * @throw InvalidParamsException Empty sequence, size mismatch or frame out
+     * of the simulation range.
+     */
+    static void validate(const SnapshotSequenceParams &params, const SimulationParameters &simulation);
+
+    /**
+     * @brief Get the number of frames of the sequence.
+     *
+     * @param params Sequence parameters.
+     * @return size_t Frame count.
+     */
+    static size_t getLength(const SnapshotSequenceParams &params);
+};
+} // namespace brayns
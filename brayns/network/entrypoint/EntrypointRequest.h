@@ -161,6 +161,20 @@ public:
         _request.progress(operation, amount);
     }
 
+    /**
+     * @brief Send a notification with binary data before the reply.
+     *
+     * @tparam NotificationType Type of notification params.
+     * @param params Notification params.
+     * @param binary Binary data of the notification.
+     */
+    template<typename NotificationType>
+    void notify(const NotificationType &params, std::string_view binary) const
+    {
+        auto json = Json::serialize(params);
+        _request.notify(json, binary);
+    }
+
 private:
     JsonRpcRequest _request;
 };
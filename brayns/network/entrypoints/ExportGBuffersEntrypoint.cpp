@@ -20,17 +20,17 @@
 
 #include "ExportGBuffersEntrypoint.h"
 
-#include <brayns/engine/core/FrameRenderer.h>
+#include <brayns/engine/core/RenderJob.h>
 #include <brayns/engine/framebuffer/types/StaticFrameHandler.h>
 
 #include <brayns/network/common/ProgressHandler.h>
+#include <brayns/network/common/RenderProgress.h>
 
 #include <brayns/utils/FileWriter.h>
 #include <brayns/utils/image/codecs/ExrCodec.h>
 #include <brayns/utils/string/StringCase.h>
 
 #include <filesystem>
-#include <thread>
 
 namespace
 {
@@ -187,7 +187,8 @@ public:
 
         // Framebuffer
         auto &imageSize = params.resolution;
-        auto framebuffer = brayns::Framebuffer(std::make_unique<brayns::StaticFrameHandler>());
+        auto &pool = engine.getFramebufferPool();
+        auto framebuffer = brayns::Framebuffer(std::make_unique<brayns::StaticFrameHandler>(pool));
         framebuffer.setAccumulation(false);
         framebuffer.setFormat(brayns::PixelFormat::RgbaF32);
         framebuffer.setFrameSize(imageSize);
@@ -206,20 +207,18 @@ public:
         camera.commit();
 
         // Scene
+        engine.synchronize();
         auto &scene = engine.getScene();
         scene.update(paramsManager);
         scene.commit();
 
         // Render
         auto progress = brayns::ProgressHandler(token, request);
-        auto future = brayns::FrameRenderer::asynchronous(camera, framebuffer, renderer, scene);
-        const auto msg = std::string("Exporting g-buffers ...");
-        while (!future.isReady())
-        {
-            const auto percentage = future.progress();
-            progress.notify(msg, percentage);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-        }
+        auto &network = paramsManager.getNetworkParameters();
+        auto period = network.getProgressPeriod();
+        auto job = brayns::RenderJob(camera, framebuffer, renderer, scene);
+        const auto operation = std::string("Exporting g-buffers ...");
+        brayns::RenderProgress::wait(job, progress, operation, period);
 
         ReplyHandler::reply(request, params, framebuffer);
     }
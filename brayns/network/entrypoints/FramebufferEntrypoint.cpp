@@ -69,9 +69,10 @@ void SetProgressiveFramebufferEntrypoint::onRequest(const Request &request)
 {
     auto params = request.getParams();
     auto scale = params.scale;
+    auto targetFrameTime = params.target_frame_time;
 
     auto &framebuffer = _engine.getFramebuffer();
-    framebuffer.setFrameHandler(std::make_unique<ProgressiveFrameHandler>(scale));
+    framebuffer.setFrameHandler(std::make_unique<ProgressiveFrameHandler>(scale, targetFrameTime));
 
     request.reply(EmptyJson());
 }
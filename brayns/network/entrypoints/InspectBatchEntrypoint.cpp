@@ -0,0 +1,243 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "InspectBatchEntrypoint.h"
+
+#include <brayns/network/jsonrpc/JsonRpcException.h>
+#include <brayns/utils/binary/ByteConverter.h>
+
+#include <cmath>
+#include <limits>
+
+namespace
+{
+class PositionListBuilder
+{
+public:
+    static inline constexpr size_t maxCount = 1 << 20;
+
+    static std::vector<brayns::Vector2f> build(const brayns::InspectBatchMessage &params)
+    {
+        auto regionSize = _getRegionSize(params);
+        auto count = params.positions.size() + size_t(regionSize.x) * size_t(regionSize.y);
+
+        if (count > maxCount)
+        {
+            throw brayns::InvalidParamsException("Cannot inspect more than " + std::to_string(maxCount) + " positions");
+        }
+
+        auto result = std::vector<brayns::Vector2f>();
+        result.reserve(count);
+
+        result.insert(result.end(), params.positions.begin(), params.positions.end());
+
+        auto &start = params.region_start;
+        auto &stride = params.region_stride;
+
+        for (size_t j = 0; j < regionSize.y; ++j)
+        {
+            for (size_t i = 0; i < regionSize.x; ++i)
+            {
+                auto offset = brayns::Vector2f(stride.x * static_cast<float>(i), stride.y * static_cast<float>(j));
+                result.push_back(start + offset);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    static brayns::Vector2ui _getRegionSize(const brayns::InspectBatchMessage &params)
+    {
+        auto &start = params.region_start;
+        auto &end = params.region_end;
+        auto &stride = params.region_stride;
+
+        if (stride.x == 0.0f && stride.y == 0.0f)
+        {
+            return brayns::Vector2ui(0);
+        }
+
+        if (stride.x <= 0.0f || stride.y <= 0.0f)
+        {
+            throw brayns::InvalidParamsException("Region stride must be strictly positive");
+        }
+
+        if (end.x < start.x || end.y < start.y)
+        {
+            throw brayns::InvalidParamsException("Region end must be greater or equal to region start");
+        }
+
+        auto size = (end - start) / stride;
+        if (size.x >= maxCount || size.y >= maxCount)
+        {
+            throw brayns::InvalidParamsException("Region stride is too small");
+        }
+
+        auto width = static_cast<uint32_t>(std::floor(size.x)) + 1;
+        auto height = static_cast<uint32_t>(std::floor(size.y)) + 1;
+        return brayns::Vector2ui(width, height);
+    }
+};
+
+class BatchPicker
+{
+public:
+    static std::vector<ospray::cpp::PickResult> pick(
+        brayns::Engine &engine,
+        const std::vector<brayns::Vector2f> &positions)
+    {
+        engine.commit();
+
+        auto &framebuffer = engine.getFramebuffer().getHandle();
+        auto &renderer = engine.getRenderer().getHandle();
+        auto &camera = engine.getCamera().getHandle();
+        auto &world = engine.getScene().getHandle();
+
+        auto results = std::vector<ospray::cpp::PickResult>(positions.size());
+
+#pragma omp parallel for schedule(dynamic, 64)
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            auto &position = positions[i];
+            results[i] = framebuffer.pick(renderer, camera, world, position.x, position.y);
+        }
+
+        return results;
+    }
+};
+
+class RecordWriter
+{
+public:
+    static inline constexpr auto noHit = std::numeric_limits<uint32_t>::max();
+    static inline constexpr size_t recordSize = sizeof(uint32_t) + sizeof(uint64_t) + 3 * sizeof(float);
+
+    explicit RecordWriter(size_t count)
+    {
+        _data.reserve(count * recordSize);
+    }
+
+    void writeMiss()
+    {
+        _write(noHit, uint64_t(0), brayns::Vector3f(0.0f));
+    }
+
+    void writeHit(uint32_t modelId, uint64_t elementId, const brayns::Vector3f &position)
+    {
+        _write(modelId, elementId, position);
+    }
+
+    const std::string &getData() const noexcept
+    {
+        return _data;
+    }
+
+private:
+    std::string _data;
+
+    void _write(uint32_t modelId, uint64_t elementId, const brayns::Vector3f &position)
+    {
+        _append(modelId);
+        _append(elementId);
+        _append(position.x);
+        _append(position.y);
+        _append(position.z);
+    }
+
+    template<typename T>
+    void _append(T value)
+    {
+        _data += brayns::ByteConverter::convertToBytes(value, std::endian::little);
+    }
+};
+
+class BatchInspector
+{
+public:
+    static brayns::InspectBatchResult inspect(
+        brayns::Engine &engine,
+        const std::vector<brayns::Vector2f> &positions,
+        RecordWriter &writer)
+    {
+        auto picks = BatchPicker::pick(engine, positions);
+        auto &models = engine.getScene().getModels();
+
+        auto result = brayns::InspectBatchResult();
+        result.count = picks.size();
+
+        // Element resolution is cheap and may update lazy caches in inspect systems so it stays on this thread
+        for (auto &pick : picks)
+        {
+            auto instance = pick.hasHit ? models.findModelInstance(pick.instance) : nullptr;
+
+            if (!instance)
+            {
+                writer.writeMiss();
+                continue;
+            }
+
+            auto &hit = pick.worldPosition;
+            auto position = brayns::Vector3f(hit[0], hit[1], hit[2]);
+            auto context = brayns::InspectContext{position, pick.model, pick.primID};
+
+            const auto &model = instance->getModel();
+            auto view = model.getSystemsView();
+            auto elementId = view.getInspectedElementId(context);
+
+            writer.writeHit(instance->getID(), elementId, position);
+            ++result.hit_count;
+        }
+
+        return result;
+    }
+};
+}
+
+namespace brayns
+{
+InspectBatchEntrypoint::InspectBatchEntrypoint(Engine &engine):
+    _engine(engine)
+{
+}
+
+std::string InspectBatchEntrypoint::getMethod() const
+{
+    return "inspect-batch";
+}
+
+std::string InspectBatchEntrypoint::getDescription() const
+{
+    return "Inspect the scene at multiple x-y positions (list and/or strided region) in one request, the hits are "
+           "returned as binary records";
+}
+
+void InspectBatchEntrypoint::onRequest(const Request &request)
+{
+    auto params = request.getParams();
+    auto positions = PositionListBuilder::build(params);
+
+    auto writer = RecordWriter(positions.size());
+    auto result = BatchInspector::inspect(_engine, positions, writer);
+
+    request.reply(result, writer.getData());
+}
+} // namespace brayns
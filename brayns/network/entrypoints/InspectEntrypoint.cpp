@@ -41,7 +41,7 @@ public:
 
         auto inspectContext = _buildInspectContext(pickResult);
         auto instance = _findHittedInstance(pickResult.instance);
-        auto &model = instance->getModel();
+        const auto &model = instance->getModel();
         auto view = model.getSystemsView();
         auto inspectResult = view.inspect(inspectContext);
         return _buildResult(inspectContext, *instance, std::move(inspectResult));
@@ -69,26 +69,13 @@ private:
 
     brayns::ModelInstance *_findHittedInstance(const ospray::cpp::Instance &pickedInstance)
     {
-        auto pickedInstanceHandle = pickedInstance.handle();
-
         auto &scene = _engine.getScene();
-        auto &instances = scene.getModels().getAllModelInstances();
-
-        auto begin = instances.begin();
-        auto end = instances.end();
-        auto instanceIterator = std::find_if(
-            begin,
-            end,
-            [&](auto &instance)
-            {
-                auto &osprayInstance = instance->getHandle();
-                auto handle = osprayInstance.handle();
-                return handle == pickedInstanceHandle;
-            });
+        auto &models = scene.getModels();
+        auto instance = models.findModelInstance(pickedInstance);
 
         // Shouldn't happen, but..
-        assert(instanceIterator != end);
-        return (*instanceIterator).get();
+        assert(instance);
+        return instance;
     }
 
     brayns::InspectContext _buildInspectContext(const ospray::cpp::PickResult &osprayPickResult)
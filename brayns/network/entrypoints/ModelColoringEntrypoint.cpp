@@ -43,7 +43,7 @@ void GetColorMethodsEntrypoint::onRequest(const Request &request)
 {
     auto params = request.getParams();
     auto &instance = ExtractModel::fromId(_models, params.id);
-    auto &model = instance.getModel();
+    const auto &model = instance.getModel();
     auto systemView = model.getSystemsView();
     request.reply(systemView.getColorMethods());
 }
@@ -0,0 +1,462 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "PlaySimulationEntrypoint.h"
+
+#include <brayns/utils/Log.h>
+#include <brayns/utils/ThreadPool.h>
+
+#include <brayns/engine/core/RenderJob.h>
+#include <brayns/engine/framebuffer/types/StaticFrameHandler.h>
+
+#include <brayns/network/common/Clock.h>
+#include <brayns/network/common/ProgressHandler.h>
+
+#include <brayns/utils/image/ImageEncoder.h>
+#include <brayns/utils/image/ImageFormat.h>
+#include <brayns/utils/string/StringCase.h>
+
+#include <algorithm>
+#include <future>
+#include <optional>
+#include <thread>
+
+namespace
+{
+/**
+ * @brief Delay between two network polls while rendering, pacing or paused, short enough to apply the playback
+ * controls without visible latency.
+ */
+constexpr auto pollPeriod = std::chrono::milliseconds(10);
+
+class ParamsBuilder
+{
+public:
+    static brayns::PlaySimulationParams build(
+        const brayns::PlaySimulationEntrypoint::Request &request,
+        brayns::Engine &engine)
+    {
+        brayns::PlaySimulationParams params;
+
+        auto &paramsManager = engine.getParametersManager();
+        auto &appParams = paramsManager.getApplicationParameters();
+        auto systemSize = appParams.getWindowSize();
+        params.image_settings = brayns::ImageSettings(systemSize);
+
+        request.getParams(params);
+
+        return params;
+    }
+};
+
+class RangeBuilder
+{
+public:
+    static std::pair<uint32_t, uint32_t> build(
+        const brayns::PlaySimulationParams &params,
+        const brayns::SimulationParameters &simulation)
+    {
+        auto start = simulation.getStartFrame();
+        auto end = simulation.getEndFrame();
+
+        auto first = params.start_frame.value_or(start);
+        auto last = params.end_frame.value_or(end);
+
+        if (first < start || last > end)
+        {
+            constexpr auto format = "Playback range [{}, {}] out of simulation range [{}, {}]";
+            throw brayns::InvalidParamsException(fmt::format(format, first, last, start, end));
+        }
+
+        return {first, last};
+    }
+};
+
+class ImageHelper
+{
+public:
+    static std::string encode(const brayns::Image &image, const std::string &format, int quality)
+    {
+        try
+        {
+            return brayns::ImageEncoder::encode(image, format, quality);
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::error("Failed to encode simulation frame: '{}'.", e.what());
+            throw brayns::InternalErrorException(e.what());
+        }
+    }
+};
+
+/**
+ * @brief Encodes a rendered frame on the shared thread pool while the next one is rendered and sends it to the client
+ * as a binary notification once done. Frames are sent in order and at most one is encoded at a time.
+ */
+class FrameStream
+{
+public:
+    FrameStream(const brayns::PlaySimulationEntrypoint::Request &request, std::string format, int quality):
+        _request(request),
+        _format(std::move(format)),
+        _quality(quality)
+    {
+    }
+
+    void push(const brayns::PlaySimulationFrame &frame, brayns::Image image)
+    {
+        flush();
+        _frame = frame;
+        _frame.id = _request.getId();
+        auto &pool = brayns::ThreadPool::getDefault();
+        _job = pool.submit(
+            [format = _format, quality = _quality, image = std::move(image)]
+            { return ImageHelper::encode(image, format, quality); });
+    }
+
+    void flush()
+    {
+        if (!_job.valid())
+        {
+            return;
+        }
+        auto data = _job.get();
+        _request.notify(_frame, data);
+    }
+
+private:
+    const brayns::PlaySimulationEntrypoint::Request &_request;
+    std::string _format;
+    int _quality;
+    brayns::PlaySimulationFrame _frame;
+    std::future<std::string> _job;
+};
+
+/**
+ * @brief Limits the stream to the target rate. When rendering is slower than the target, frames are produced back to
+ * back without trying to catch up.
+ */
+class FramePacer
+{
+public:
+    explicit FramePacer(double fps):
+        _interval(_getInterval(fps)),
+        _deadline(brayns::Clock::now())
+    {
+    }
+
+    template<typename Callable>
+    void wait(Callable poll)
+    {
+        if (_interval == brayns::Duration::zero())
+        {
+            return;
+        }
+        _deadline += _interval;
+        auto now = brayns::Clock::now();
+        if (_deadline < now)
+        {
+            _deadline = now;
+            return;
+        }
+        while (now < _deadline)
+        {
+            poll();
+            auto remaining = std::chrono::duration_cast<brayns::Duration>(_deadline - now);
+            std::this_thread::sleep_for(std::min<brayns::Duration>(remaining, pollPeriod));
+            now = brayns::Clock::now();
+        }
+    }
+
+    void reset()
+    {
+        _deadline = brayns::Clock::now();
+    }
+
+private:
+    static brayns::Duration _getInterval(double fps)
+    {
+        if (fps <= 0.0)
+        {
+            return brayns::Duration::zero();
+        }
+        auto seconds = std::chrono::duration<double>(1.0 / fps);
+        return std::chrono::duration_cast<brayns::Duration>(seconds);
+    }
+
+private:
+    brayns::Duration _interval;
+    brayns::TimePoint _deadline;
+};
+
+/**
+ * @brief Stops the shared playback and publishes the last frame rendered to the engine simulation parameters when the
+ * loop exits, including on cancellation.
+ */
+class PlaybackGuard
+{
+public:
+    PlaybackGuard(brayns::SimulationPlayback &playback, brayns::SimulationParameters &simulation):
+        _playback(playback),
+        _simulation(simulation)
+    {
+    }
+
+    ~PlaybackGuard()
+    {
+        _playback.stop();
+        if (!_lastFrame)
+        {
+            return;
+        }
+        try
+        {
+            _simulation.setFrame(*_lastFrame);
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::warn("Cannot restore simulation frame after playback: '{}'.", e.what());
+        }
+    }
+
+    PlaybackGuard(const PlaybackGuard &) = delete;
+    PlaybackGuard &operator=(const PlaybackGuard &) = delete;
+
+    void setLastFrame(uint32_t frame)
+    {
+        _lastFrame = frame;
+    }
+
+private:
+    brayns::SimulationPlayback &_playback;
+    brayns::SimulationParameters &_simulation;
+    std::optional<uint32_t> _lastFrame;
+};
+
+class PlaybackHandler
+{
+public:
+    static brayns::PlaySimulationResult handle(
+        const brayns::PlaySimulationEntrypoint::Request &request,
+        const brayns::PlaySimulationParams &params,
+        brayns::CancellationToken &token,
+        brayns::Engine &engine,
+        brayns::SimulationParameters &engineSimulation,
+        brayns::SimulationPlayback &playback)
+    {
+        // Parameters
+        auto paramsManager = engine.getParametersManager();
+        auto &simulation = paramsManager.getSimulationParameters();
+        auto [startFrame, endFrame] = RangeBuilder::build(params, simulation);
+
+        auto &factories = engine.getFactories();
+
+        // Renderer
+        auto &rendererData = params.renderer;
+        auto &rendererFactory = factories.renderer;
+        auto renderer = rendererFactory.createOr(rendererData, engine.getRenderer());
+        renderer.commit();
+
+        // Framebuffer
+        auto &imageSettings = params.image_settings;
+        auto &imageSize = imageSettings.getSize();
+        auto &pool = engine.getFramebufferPool();
+        auto framebuffer = brayns::Framebuffer(std::make_unique<brayns::StaticFrameHandler>(pool));
+        framebuffer.setAccumulation(false);
+        framebuffer.setFormat(brayns::PixelFormat::StandardRgbaI8);
+        framebuffer.setFrameSize(imageSize);
+        framebuffer.commit();
+
+        // Camera
+        auto &cameraData = params.camera;
+        auto &cameraFactory = factories.cameras;
+        auto camera = cameraFactory.createOr(cameraData, engine.getCamera());
+        camera.setAspectRatioFromFrameSize(imageSize);
+        camera.commit();
+
+        // Output
+        auto extension = brayns::StringCase::toLower(imageSettings.getFormat());
+        auto format = brayns::ImageFormat::fromExtension(extension);
+        auto quality = static_cast<int>(imageSettings.getQuality());
+
+        // Scene
+        engine.synchronize();
+        auto &scene = engine.getScene();
+
+        // Playback
+        playback.start(startFrame, endFrame, params.speed, params.loop);
+        auto guard = PlaybackGuard(playback, engineSimulation);
+        auto progress = brayns::ProgressHandler(token, request);
+        auto poll = [&] { progress.poll(); };
+        auto stream = FrameStream(request, format, quality);
+        auto pacer = FramePacer(params.fps);
+        auto dt = simulation.getDt();
+        auto result = brayns::PlaySimulationResult();
+
+        while (true)
+        {
+            // Render frame N + 1 while frame N is encoded
+            auto frame = playback.getFrame();
+            simulation.setFrame(frame);
+            scene.update(paramsManager);
+            scene.commit();
+
+            auto job = brayns::RenderJob(camera, framebuffer, renderer, scene);
+            while (!job.waitFor(pollPeriod))
+            {
+                progress.poll();
+            }
+
+            auto notification = brayns::PlaySimulationFrame();
+            notification.index = result.frame_count;
+            notification.frame = frame;
+            notification.timestamp = frame * dt;
+            stream.push(notification, framebuffer.getImage());
+
+            guard.setLastFrame(frame);
+            result.last_frame = frame;
+            ++result.frame_count;
+
+            pacer.wait(poll);
+
+            if (playback.isPaused())
+            {
+                stream.flush();
+                while (playback.isPaused())
+                {
+                    std::this_thread::sleep_for(pollPeriod);
+                    progress.poll();
+                }
+                pacer.reset();
+            }
+
+            if (!playback.advance())
+            {
+                break;
+            }
+        }
+
+        stream.flush();
+
+        return result;
+    }
+};
+} // namespace
+
+namespace brayns
+{
+PlaySimulationEntrypoint::PlaySimulationEntrypoint(
+    Engine &engine,
+    SimulationParameters &simulation,
+    std::shared_ptr<SimulationPlayback> playback,
+    CancellationToken token):
+    _engine(engine),
+    _simulation(simulation),
+    _playback(std::move(playback)),
+    _token(token)
+{
+}
+
+std::string PlaySimulationEntrypoint::getMethod() const
+{
+    return "play-simulation";
+}
+
+std::string PlaySimulationEntrypoint::getDescription() const
+{
+    return "Play the simulation on the server at the given rate, each rendered frame is streamed to the client as a "
+           "binary notification until the end frame is reached or the request is cancelled. Use "
+           "control-simulation-playback to pause, seek or change the speed";
+}
+
+bool PlaySimulationEntrypoint::isAsync() const
+{
+    return true;
+}
+
+void PlaySimulationEntrypoint::onRequest(const Request &request)
+{
+    auto params = ParamsBuilder::build(request, _engine);
+    auto result = PlaybackHandler::handle(request, params, _token, _engine, _simulation, *_playback);
+    request.reply(result);
+}
+
+void PlaySimulationEntrypoint::onCancel()
+{
+    _token.cancel();
+}
+
+void PlaySimulationEntrypoint::onDisconnect()
+{
+    _token.cancel();
+}
+
+ControlSimulationPlaybackEntrypoint::ControlSimulationPlaybackEntrypoint(std::shared_ptr<SimulationPlayback> playback):
+    _playback(std::move(playback))
+{
+}
+
+std::string ControlSimulationPlaybackEntrypoint::getMethod() const
+{
+    return "control-simulation-playback";
+}
+
+std::string ControlSimulationPlaybackEntrypoint::getDescription() const
+{
+    return "Pause, resume, seek or change the speed of the running play-simulation and return the playback state";
+}
+
+bool ControlSimulationPlaybackEntrypoint::hasPriority() const
+{
+    return true;
+}
+
+void ControlSimulationPlaybackEntrypoint::onRequest(const Request &request)
+{
+    auto params = request.getParams();
+    auto &playback = *_playback;
+    auto control = params.paused || params.frame || params.speed;
+    if (control && !playback.isPlaying())
+    {
+        throw InvalidParamsException("No simulation playback running");
+    }
+    if (params.speed)
+    {
+        playback.setSpeed(*params.speed);
+    }
+    if (params.frame)
+    {
+        playback.seek(*params.frame);
+    }
+    if (params.paused)
+    {
+        playback.setPaused(*params.paused);
+    }
+    auto state = SimulationPlaybackState();
+    state.playing = playback.isPlaying();
+    state.paused = playback.isPaused();
+    state.frame = playback.getFrame();
+    state.speed = playback.getSpeed();
+    state.start_frame = playback.getStartFrame();
+    state.end_frame = playback.getEndFrame();
+    request.reply(state);
+}
+} // namespace brayns
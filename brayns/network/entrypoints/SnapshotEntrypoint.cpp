@@ -22,17 +22,20 @@
 
 #include <brayns/utils/Log.h>
 
-#include <brayns/engine/core/FrameRenderer.h>
+#include <brayns/engine/core/RenderJob.h>
 #include <brayns/engine/framebuffer/types/StaticFrameHandler.h>
 
 #include <brayns/network/common/ProgressHandler.h>
+#include <brayns/network/common/RenderProgress.h>
 
 #include <brayns/utils/image/ImageEncoder.h>
 #include <brayns/utils/image/ImageFormat.h>
+#include <brayns/utils/image/ImageStreamWriter.h>
 #include <brayns/utils/string/StringCase.h>
 
-#include <chrono>
-#include <thread>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
 
 namespace
 {
@@ -67,6 +70,44 @@ public:
     }
 };
 
+class ImageFormatHelper
+{
+public:
+    static std::string get(const brayns::SnapshotParams &params)
+    {
+        auto &path = params.file_path;
+        if (!path.empty())
+        {
+            auto format = brayns::ImageFormat::fromFilename(path);
+            return brayns::StringCase::toLower(format);
+        }
+        auto &settings = params.image_settings;
+        return brayns::StringCase::toLower(settings.getFormat());
+    }
+};
+
+class ParamsValidator
+{
+public:
+    static void validate(const brayns::SnapshotParams &params)
+    {
+        auto tileSize = params.tile_size;
+        if (tileSize == 0)
+        {
+            return;
+        }
+        if (tileSize < 128)
+        {
+            throw brayns::InvalidParamsException("Tile size must be at least 128");
+        }
+        auto format = ImageFormatHelper::get(params);
+        if (!brayns::ImageStreamWriterFactory::isSupported(format))
+        {
+            throw brayns::InvalidParamsException("Tiled snapshots only support PNG and EXR formats");
+        }
+    }
+};
+
 class ImageHelper
 {
 public:
@@ -124,11 +165,21 @@ public:
         if (path.empty())
         {
             auto data = ImageHelper::encode(image, format, quality, metadata);
-            auto result = _formatResult(data.size());
-            request.reply(result, data);
+            replyData(request, data);
             return;
         }
         ImageHelper::save(image, path, quality, metadata);
+        replySaved(request);
+    }
+
+    static void replyData(const brayns::SnapshotEntrypoint::Request &request, const std::string &data)
+    {
+        auto result = _formatResult(data.size());
+        request.reply(result, data);
+    }
+
+    static void replySaved(const brayns::SnapshotEntrypoint::Request &request)
+    {
         auto result = _formatResult(0);
         request.reply(result);
     }
@@ -143,6 +194,179 @@ private:
     }
 };
 
+class TileLayout
+{
+public:
+    /**
+     * @brief Split size in tiles as even as possible, so each one is at least tileSize / 2.
+     *
+     * @return std::vector<size_t> Tile offsets with size as last element.
+     */
+    static std::vector<size_t> split(size_t size, size_t tileSize)
+    {
+        auto count = (size + tileSize - 1) / tileSize;
+
+        auto offsets = std::vector<size_t>();
+        offsets.reserve(count + 1);
+
+        for (size_t i = 0; i <= count; ++i)
+        {
+            offsets.push_back(i * size / count);
+        }
+
+        return offsets;
+    }
+};
+
+class TileRegion
+{
+public:
+    static brayns::Box2 compute(
+        const brayns::SnapshotParams &params,
+        const brayns::Vector2ui &imageSize,
+        const brayns::Vector2ui &start,
+        const brayns::Vector2ui &end)
+    {
+        auto size = brayns::Vector2f(imageSize);
+        auto lower = _interpolate(params, brayns::Vector2f(start) / size);
+        auto upper = _interpolate(params, brayns::Vector2f(end) / size);
+        return {lower, upper};
+    }
+
+private:
+    static brayns::Vector2f _interpolate(const brayns::SnapshotParams &params, const brayns::Vector2f &ratio)
+    {
+        auto &start = params.image_start;
+        auto &end = params.image_end;
+        auto value = start + (end - start) * ratio;
+        return {std::clamp(value.x, 0.0f, 1.0f), std::clamp(value.y, 0.0f, 1.0f)};
+    }
+};
+
+class TiledRenderer
+{
+public:
+    static void render(
+        const brayns::SnapshotParams &params,
+        const brayns::ProgressHandler<brayns::SnapshotEntrypoint::Request> &progress,
+        std::chrono::milliseconds period,
+        brayns::Camera &camera,
+        brayns::Framebuffer &framebuffer,
+        brayns::Renderer &renderer,
+        brayns::Scene &scene,
+        std::ostream &stream)
+    {
+        auto &imageSize = params.image_settings.getSize();
+        auto tileSize = params.tile_size;
+        auto columns = TileLayout::split(imageSize.x, tileSize);
+        auto rows = TileLayout::split(imageSize.y, tileSize);
+
+        auto info = brayns::ImageInfo();
+        info.width = imageSize.x;
+        info.channelCount = 4;
+        info.channelSize = 1;
+
+        auto imageInfo = info;
+        imageInfo.height = imageSize.y;
+
+        auto format = ImageFormatHelper::get(params);
+        auto writer = brayns::ImageStreamWriterFactory::create(stream, imageInfo, format, params.metadata);
+
+        auto tileCount = (columns.size() - 1) * (rows.size() - 1);
+        auto tileIndex = size_t(0);
+
+        for (size_t j = 1; j < rows.size(); ++j)
+        {
+            // Only one row of tiles is kept in memory before being encoded
+            info.height = rows[j] - rows[j - 1];
+            auto band = brayns::Image(info);
+
+            for (size_t i = 1; i < columns.size(); ++i)
+            {
+                auto start = brayns::Vector2ui(columns[i - 1], rows[j - 1]);
+                auto end = brayns::Vector2ui(columns[i], rows[j]);
+
+                framebuffer.setFrameSize(end - start);
+                framebuffer.commit();
+
+                camera.setImageRegion(TileRegion::compute(params, imageSize, start, end));
+                camera.commit();
+
+                ++tileIndex;
+                auto job = brayns::RenderJob(camera, framebuffer, renderer, scene);
+                auto operation = fmt::format("Rendering tile {}/{} ...", tileIndex, tileCount);
+                brayns::RenderProgress::wait(job, progress, operation, period);
+
+                auto tile = framebuffer.getImage();
+                band.write(tile, start.x, 0);
+            }
+
+            writer->write(band);
+        }
+
+        writer->finish();
+    }
+};
+
+class TiledSnapshotHandler
+{
+public:
+    static void handle(
+        const brayns::SnapshotEntrypoint::Request &request,
+        const brayns::SnapshotParams &params,
+        const brayns::ProgressHandler<brayns::SnapshotEntrypoint::Request> &progress,
+        std::chrono::milliseconds period,
+        brayns::Camera &camera,
+        brayns::Framebuffer &framebuffer,
+        brayns::Renderer &renderer,
+        brayns::Scene &scene)
+    {
+        auto &path = params.file_path;
+
+        if (path.empty())
+        {
+            auto stream = std::ostringstream();
+            _render(params, progress, period, camera, framebuffer, renderer, scene, stream);
+            ReplyHandler::replyData(request, stream.str());
+            return;
+        }
+
+        auto stream = std::ofstream(path, std::ios::binary);
+        if (!stream)
+        {
+            throw brayns::InternalErrorException("Cannot open '" + path + "'");
+        }
+        _render(params, progress, period, camera, framebuffer, renderer, scene, stream);
+        ReplyHandler::replySaved(request);
+    }
+
+private:
+    static void _render(
+        const brayns::SnapshotParams &params,
+        const brayns::ProgressHandler<brayns::SnapshotEntrypoint::Request> &progress,
+        std::chrono::milliseconds period,
+        brayns::Camera &camera,
+        brayns::Framebuffer &framebuffer,
+        brayns::Renderer &renderer,
+        brayns::Scene &scene,
+        std::ostream &stream)
+    {
+        try
+        {
+            TiledRenderer::render(params, progress, period, camera, framebuffer, renderer, scene, stream);
+        }
+        catch (const brayns::JsonRpcException &)
+        {
+            throw;
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::error("Failed to render tiled snapshot: '{}'.", e.what());
+            throw brayns::InternalErrorException(e.what());
+        }
+    }
+};
+
 class SnapshotHandler
 {
 public:
@@ -169,11 +393,10 @@ public:
         // Framebuffer
         auto &imageSettings = params.image_settings;
         auto &imageSize = imageSettings.getSize();
-        auto framebuffer = brayns::Framebuffer(std::make_unique<brayns::StaticFrameHandler>());
+        auto &pool = engine.getFramebufferPool();
+        auto framebuffer = brayns::Framebuffer(std::make_unique<brayns::StaticFrameHandler>(pool));
         framebuffer.setAccumulation(false);
         framebuffer.setFormat(brayns::PixelFormat::StandardRgbaI8);
-        framebuffer.setFrameSize(imageSize);
-        framebuffer.commit();
 
         // Camera
         auto &cameraData = params.camera;
@@ -186,21 +409,29 @@ public:
         camera.commit();
 
         // Scene
+        engine.synchronize();
         auto &scene = engine.getScene();
         scene.update(paramsManager);
         scene.commit();
 
         // Render
         auto progress = brayns::ProgressHandler(token, request);
-        auto future = brayns::FrameRenderer::asynchronous(camera, framebuffer, renderer, scene);
-        const auto msg = "Rendering snapshot ...";
-        while (!future.isReady())
+        auto &network = paramsManager.getNetworkParameters();
+        auto period = network.getProgressPeriod();
+
+        if (params.tile_size != 0)
         {
-            const auto percentage = future.progress();
-            progress.notify(msg, percentage);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+            TiledSnapshotHandler::handle(request, params, progress, period, camera, framebuffer, renderer, scene);
+            return;
         }
 
+        framebuffer.setFrameSize(imageSize);
+        framebuffer.commit();
+
+        auto job = brayns::RenderJob(camera, framebuffer, renderer, scene);
+        const auto operation = "Rendering snapshot ...";
+        brayns::RenderProgress::wait(job, progress, operation, period);
+
         ReplyHandler::reply(request, params, framebuffer);
     }
 };
@@ -232,6 +463,7 @@ bool SnapshotEntrypoint::isAsync() const
 void SnapshotEntrypoint::onRequest(const Request &request)
 {
     auto params = ParamsBuilder::build(request, _engine);
+    ParamsValidator::validate(params);
     _download = params.file_path.empty();
     SnapshotHandler::handle(request, params, _token, _engine);
 }
@@ -0,0 +1,350 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "SnapshotSequenceEntrypoint.h"
+
+#include <brayns/utils/Log.h>
+#include <brayns/utils/ThreadPool.h>
+
+#include <brayns/engine/core/RenderJob.h>
+#include <brayns/engine/framebuffer/types/StaticFrameHandler.h>
+
+#include <brayns/network/common/ProgressHandler.h>
+#include <brayns/network/common/RenderProgress.h>
+#include <brayns/network/common/SnapshotSequence.h>
+
+#include <brayns/utils/image/ImageEncoder.h>
+#include <brayns/utils/image/ImageFormat.h>
+#include <brayns/utils/string/StringCase.h>
+
+#include <deque>
+#include <filesystem>
+#include <future>
+
+namespace
+{
+class ParamsBuilder
+{
+public:
+    static brayns::SnapshotSequenceParams build(
+        const brayns::SnapshotSequenceEntrypoint::Request &request,
+        brayns::Engine &engine)
+    {
+        brayns::SnapshotSequenceParams params;
+
+        auto &camera = engine.getCamera();
+        params.camera_near_clip = camera.getNearClippingDistance();
+
+        const auto &region = camera.getImageRegion();
+        params.image_start = region.lower;
+        params.image_end = region.upper;
+
+        auto &paramsManager = engine.getParametersManager();
+
+        auto &appParams = paramsManager.getApplicationParameters();
+        auto systemSize = appParams.getWindowSize();
+        params.image_settings = brayns::ImageSettings(systemSize);
+
+        request.getParams(params);
+
+        return params;
+    }
+};
+
+class FramePath
+{
+public:
+    static std::string build(const std::string &folder, size_t index, const std::string &extension)
+    {
+        auto filename = fmt::format("{:05}.{}", index, extension);
+        auto path = std::filesystem::path(folder) / filename;
+        return path.string();
+    }
+
+    static void createFolder(const std::string &folder)
+    {
+        try
+        {
+            std::filesystem::create_directories(folder);
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::error("Failed to create snapshot sequence folder: '{}'.", e.what());
+            throw brayns::InvalidParamsException(e.what());
+        }
+    }
+};
+
+class ImageHelper
+{
+public:
+    static void save(
+        const brayns::Image &image,
+        const std::string &path,
+        int quality,
+        const std::optional<brayns::ImageMetadata> &metadata)
+    {
+        try
+        {
+            brayns::ImageEncoder::save(image, path, quality, metadata);
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::error("Failed to save snapshot: '{}'.", e.what());
+            throw brayns::InternalErrorException(e.what());
+        }
+    }
+
+    static std::string encode(
+        const brayns::Image &image,
+        const std::string &format,
+        int quality,
+        const std::optional<brayns::ImageMetadata> &metadata)
+    {
+        try
+        {
+            return brayns::ImageEncoder::encode(image, format, quality, metadata);
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::error("Failed to encode snapshot: '{}'.", e.what());
+            throw brayns::InternalErrorException(e.what());
+        }
+    }
+};
+
+/**
+ * @brief Encodes the rendered frames on the shared thread pool while the next ones are rendered. The number of
+ * frames encoded concurrently is bounded to limit the memory used by the raw images.
+ *
+ * Encoded frames are streamed to the client as binary notifications, in order, as soon as they are ready, so that
+ * only the frames being encoded are held in memory.
+ */
+class EncodingQueue
+{
+public:
+    EncodingQueue(const brayns::SnapshotSequenceEntrypoint::Request &request, brayns::ThreadPool &pool):
+        _request(request),
+        _pool(pool),
+        _maxJobs(pool.getWorkerCount())
+    {
+    }
+
+    template<typename Callable>
+    void push(Callable callable)
+    {
+        if (_jobs.size() >= _maxJobs)
+        {
+            _pop();
+        }
+        _jobs.push_back(_pool.submit(std::move(callable)));
+    }
+
+    void finish()
+    {
+        while (!_jobs.empty())
+        {
+            _pop();
+        }
+    }
+
+private:
+    void _pop()
+    {
+        auto job = std::move(_jobs.front());
+        _jobs.pop_front();
+
+        auto data = job.get();
+        auto index = _index++;
+
+        // Frames saved to disk are not streamed
+        if (data.empty())
+        {
+            return;
+        }
+
+        auto frame = brayns::SnapshotSequenceFrame();
+        frame.id = _request.getId();
+        frame.index = index;
+        _request.notify(frame, data);
+    }
+
+private:
+    const brayns::SnapshotSequenceEntrypoint::Request &_request;
+    brayns::ThreadPool &_pool;
+    size_t _maxJobs;
+    size_t _index = 0;
+    std::deque<std::future<std::string>> _jobs;
+};
+
+class SequenceHandler
+{
+public:
+    static void handle(
+        const brayns::SnapshotSequenceEntrypoint::Request &request,
+        const brayns::SnapshotSequenceParams &params,
+        brayns::CancellationToken &token,
+        brayns::Engine &engine)
+    {
+        // Parameters
+        auto paramsManager = engine.getParametersManager();
+        auto &simulation = paramsManager.getSimulationParameters();
+        brayns::SnapshotSequence::validate(params, simulation);
+
+        auto &factories = engine.getFactories();
+
+        // Renderer
+        auto &rendererData = params.renderer;
+        auto &rendererFactory = factories.renderer;
+        auto renderer = rendererFactory.createOr(rendererData, engine.getRenderer());
+        renderer.commit();
+
+        // Framebuffer
+        auto &imageSettings = params.image_settings;
+        auto &imageSize = imageSettings.getSize();
+        auto &pool = engine.getFramebufferPool();
+        auto framebuffer = brayns::Framebuffer(std::make_unique<brayns::StaticFrameHandler>(pool));
+        framebuffer.setAccumulation(false);
+        framebuffer.setFormat(brayns::PixelFormat::StandardRgbaI8);
+        framebuffer.setFrameSize(imageSize);
+        framebuffer.commit();
+
+        // Camera
+        auto &cameraData = params.camera;
+        auto &cameraFactory = factories.cameras;
+        auto camera = cameraFactory.createOr(cameraData, engine.getCamera());
+        camera.setAspectRatioFromFrameSize(imageSize);
+        camera.setNearClippingDistance(params.camera_near_clip);
+        camera.setImageRegion({params.image_start, params.image_end});
+
+        // Output
+        auto &folder = params.folder;
+        auto extension = brayns::StringCase::toLower(imageSettings.getFormat());
+        auto format = brayns::ImageFormat::fromExtension(extension);
+        auto quality = static_cast<int>(imageSettings.getQuality());
+        auto &metadata = params.metadata;
+        if (!folder.empty())
+        {
+            FramePath::createFolder(folder);
+        }
+
+        // Scene
+        engine.synchronize();
+        auto &scene = engine.getScene();
+
+        // Render frame N + 1 while frame N is encoded
+        auto progress = brayns::ProgressHandler(token, request);
+        auto &network = paramsManager.getNetworkParameters();
+        auto period = network.getProgressPeriod();
+        auto encoders = EncodingQueue(request, brayns::ThreadPool::getDefault());
+        auto length = brayns::SnapshotSequence::getLength(params);
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (!params.camera_views.empty())
+            {
+                camera.setView(params.camera_views[i]);
+            }
+            camera.commit();
+
+            if (!params.simulation_frames.empty())
+            {
+                simulation.setFrame(params.simulation_frames[i]);
+            }
+            scene.update(paramsManager);
+            scene.commit();
+
+            auto job = brayns::RenderJob(camera, framebuffer, renderer, scene);
+            auto operation = fmt::format("Rendering frame {}/{} ...", i + 1, length);
+            brayns::RenderProgress::wait(job, progress, operation, period);
+
+            auto image = framebuffer.getImage();
+
+            if (folder.empty())
+            {
+                encoders.push([=, image = std::move(image)]
+                              { return ImageHelper::encode(image, format, quality, metadata); });
+                continue;
+            }
+
+            auto path = FramePath::build(folder, i, extension);
+            encoders.push(
+                [=, image = std::move(image)]
+                {
+                    ImageHelper::save(image, path, quality, metadata);
+                    return std::string();
+                });
+        }
+
+        encoders.finish();
+
+        auto result = brayns::SnapshotSequenceResult();
+        result.frame_count = length;
+        request.reply(result);
+    }
+};
+} // namespace
+
+namespace brayns
+{
+SnapshotSequenceEntrypoint::SnapshotSequenceEntrypoint(Engine &engine, CancellationToken token):
+    _engine(engine),
+    _token(token)
+{
+}
+
+std::string SnapshotSequenceEntrypoint::getMethod() const
+{
+    return "snapshot-sequence";
+}
+
+std::string SnapshotSequenceEntrypoint::getDescription() const
+{
+    return "Take a sequence of snapshots with given camera views and/or simulation frames, encoding the frames in "
+           "parallel with the rendering of the next ones and streaming them as binary notifications if not saved to "
+           "disk";
+}
+
+bool SnapshotSequenceEntrypoint::isAsync() const
+{
+    return true;
+}
+
+void SnapshotSequenceEntrypoint::onRequest(const Request &request)
+{
+    auto params = ParamsBuilder::build(request, _engine);
+    _download = params.folder.empty();
+    SequenceHandler::handle(request, params, _token, _engine);
+}
+
+void SnapshotSequenceEntrypoint::onCancel()
+{
+    _token.cancel();
+}
+
+void SnapshotSequenceEntrypoint::onDisconnect()
+{
+    if (_download)
+    {
+        _token.cancel();
+    }
+}
+} // namespace brayns
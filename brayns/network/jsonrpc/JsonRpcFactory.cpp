@@ -75,4 +75,13 @@ ProgressMessage JsonRpcFactory::progress(const RequestMessage &request, const st
     progress.params.amount = amount;
     return progress;
 }
+
+NotificationMessage JsonRpcFactory::notification(const RequestMessage &request, const JsonValue &params)
+{
+    NotificationMessage notification;
+    notification.jsonrpc = request.jsonrpc;
+    notification.method = request.method;
+    notification.params = params;
+    return notification;
+}
 } // namespace brayns
@@ -92,5 +92,17 @@ public:
      * @return ProgressMessage The progress message corresponding to request.
      */
     static ProgressMessage progress(const RequestMessage &request, const std::string &operation, double amount);
+
+    /**
+     * @brief Create a NotificationMessage corresponding to a RequestMessage.
+     *
+     * The resulting notification message will have the same method as the
+     * request and the given params.
+     *
+     * @param request Request message containing the transaction info.
+     * @param params Notification content.
+     * @return NotificationMessage The notification message of the request.
+     */
+    static NotificationMessage notification(const RequestMessage &request, const JsonValue &params);
 };
 } // namespace brayns
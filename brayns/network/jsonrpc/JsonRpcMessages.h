@@ -272,4 +272,42 @@ struct JsonAdapter<ProgressMessage> : ObjectAdapter<ProgressMessage>
         return builder.build();
     }
 };
+
+/**
+ * @brief Notification sent by Brayns during a request processing.
+ *
+ * Used to stream data to the client before the request reply.
+ *
+ */
+struct NotificationMessage
+{
+    std::string jsonrpc;
+    std::string method;
+    JsonValue params;
+};
+
+template<>
+struct JsonAdapter<NotificationMessage> : ObjectAdapter<NotificationMessage>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("NotificationMessage");
+        builder
+            .get(
+                "jsonrpc",
+                [](auto &object) -> auto & { return object.jsonrpc; })
+            .description("JSON-RPC version");
+        builder
+            .get(
+                "method",
+                [](auto &object) -> auto & { return object.method; })
+            .description("Entrypoint name");
+        builder
+            .get(
+                "params",
+                [](auto &object) -> auto & { return object.params; })
+            .description("Notification content");
+        return builder.build();
+    }
+};
 } // namespace brayns
@@ -99,4 +99,14 @@ void JsonRpcRequest::progress(const std::string &operation, double amount) const
     auto message = JsonRpcFactory::progress(_message, operation, amount);
     ClientSender::sendText(message, _client);
 }
+
+void JsonRpcRequest::notify(const JsonValue &params, std::string_view binary) const
+{
+    if (_message.id.isEmpty())
+    {
+        return;
+    }
+    auto message = JsonRpcFactory::notification(_message, params);
+    ClientSender::sendBinary(message, binary, _client);
+}
 } // namespace brayns
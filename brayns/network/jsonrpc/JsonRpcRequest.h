@@ -119,6 +119,14 @@ public:
      */
     void progress(const std::string &operation, double amount) const;
 
+    /**
+     * @brief Send a notification with binary data before the reply.
+     *
+     * @param params Message content stored under "params" in the notification.
+     * @param binary Binary data packed with JSON notification.
+     */
+    void notify(const JsonValue &params, std::string_view binary) const;
+
 private:
     ClientRef _client;
     RequestMessage _message;
@@ -0,0 +1,97 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/json/Json.h>
+
+namespace brayns
+{
+struct InspectBatchMessage
+{
+    std::vector<Vector2f> positions;
+    Vector2f region_start{0.0f};
+    Vector2f region_end{0.0f};
+    Vector2f region_stride{0.0f};
+};
+
+template<>
+struct JsonAdapter<InspectBatchMessage> : ObjectAdapter<InspectBatchMessage>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("InspectBatchMessage");
+        builder
+            .getset(
+                "positions",
+                [](auto &object) -> auto & { return object.positions; },
+                [](auto &object, auto value) { object.positions = std::move(value); })
+            .description("List of normalized screen positions XY to inspect")
+            .required(false);
+        builder
+            .getset(
+                "region_start",
+                [](auto &object) -> auto & { return object.region_start; },
+                [](auto &object, const auto &value) { object.region_start = value; })
+            .description("Lower corner of a normalized screen region to inspect, appended after positions")
+            .required(false);
+        builder
+            .getset(
+                "region_end",
+                [](auto &object) -> auto & { return object.region_end; },
+                [](auto &object, const auto &value) { object.region_end = value; })
+            .description("Upper corner (inclusive) of the normalized screen region to inspect")
+            .required(false);
+        builder
+            .getset(
+                "region_stride",
+                [](auto &object) -> auto & { return object.region_stride; },
+                [](auto &object, const auto &value) { object.region_stride = value; })
+            .description("Normalized XY step between two inspected positions in the region, zero to disable region")
+            .required(false);
+        return builder.build();
+    }
+};
+
+struct InspectBatchResult
+{
+    size_t count = 0;
+    size_t hit_count = 0;
+};
+
+template<>
+struct JsonAdapter<InspectBatchResult> : ObjectAdapter<InspectBatchResult>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("InspectBatchResult");
+        builder.get("count", [](auto &object) { return object.count; })
+            .description(
+                "Number of inspected positions. The attached binary contains one 24 bytes little endian record per "
+                "position, in request order (positions then region rows): model ID (uint32, 0xFFFFFFFF if nothing was "
+                "hit), element ID (uint64, cell ID for circuits, primitive index otherwise), world position XYZ "
+                "(3 x float32)");
+        builder.get("hit_count", [](auto &object) { return object.hit_count; })
+            .description("Number of positions where a model was hit");
+        return builder.build();
+    }
+};
+} // namespace brayns
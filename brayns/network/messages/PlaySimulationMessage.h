@@ -0,0 +1,230 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/json/Json.h>
+
+#include <brayns/engine/json/adapters/EngineObjectDataAdapter.h>
+#include <brayns/network/jsonrpc/RequestId.h>
+#include <brayns/network/messages/ImageSettingsMessage.h>
+
+#include <optional>
+
+namespace brayns
+{
+struct PlaySimulationParams
+{
+    ImageSettings image_settings;
+    EngineObjectData camera;
+    EngineObjectData renderer;
+    std::optional<uint32_t> start_frame;
+    std::optional<uint32_t> end_frame;
+    double speed = 1.0;
+    double fps = 25.0;
+    bool loop = false;
+};
+
+template<>
+struct JsonAdapter<PlaySimulationParams> : ObjectAdapter<PlaySimulationParams>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("PlaySimulationParams");
+        builder
+            .getset(
+                "image_settings",
+                [](auto &object) -> auto & { return object.image_settings; },
+                [](auto &object, auto value) { object.image_settings = std::move(value); })
+            .description("Image settings of the streamed frames")
+            .required(false);
+        builder
+            .getset(
+                "camera",
+                [](auto &object) -> auto & { return object.camera; },
+                [](auto &object, const auto &value) { object.camera = value; })
+            .description("Camera definition, current camera is used if not set")
+            .required(false);
+        builder
+            .getset(
+                "renderer",
+                [](auto &object) -> auto & { return object.renderer; },
+                [](auto &object, const auto &value) { object.renderer = value; })
+            .description("Renderer definition, current renderer is used if not set")
+            .required(false);
+        builder
+            .getset(
+                "start_frame",
+                [](auto &object) -> auto & { return object.start_frame; },
+                [](auto &object, const auto &value) { object.start_frame = value; })
+            .description("First frame of the playback, simulation start frame if not set")
+            .required(false);
+        builder
+            .getset(
+                "end_frame",
+                [](auto &object) -> auto & { return object.end_frame; },
+                [](auto &object, const auto &value) { object.end_frame = value; })
+            .description("Last frame of the playback, simulation end frame if not set")
+            .required(false);
+        builder
+            .getset(
+                "speed",
+                [](auto &object) { return object.speed; },
+                [](auto &object, auto value) { object.speed = value; })
+            .description("Simulation frames advanced per streamed frame, negative to play backward")
+            .defaultValue(1.0);
+        builder
+            .getset(
+                "fps",
+                [](auto &object) { return object.fps; },
+                [](auto &object, auto value) { object.fps = value; })
+            .description("Target streamed frames per second, 0 to stream as fast as possible")
+            .minimum(0)
+            .defaultValue(25.0);
+        builder
+            .getset(
+                "loop",
+                [](auto &object) { return object.loop; },
+                [](auto &object, auto value) { object.loop = value; })
+            .description("Restart the playback once the last frame is reached, stops only when cancelled")
+            .defaultValue(false);
+        return builder.build();
+    }
+};
+
+struct PlaySimulationFrame
+{
+    RequestId id;
+    size_t index = 0;
+    uint32_t frame = 0;
+    double timestamp = 0.0;
+};
+
+template<>
+struct JsonAdapter<PlaySimulationFrame> : ObjectAdapter<PlaySimulationFrame>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("PlaySimulationFrame");
+        builder
+            .get(
+                "id",
+                [](auto &object) -> auto & { return object.id; })
+            .description("ID of the play-simulation request");
+        builder.get("index", [](auto &object) { return object.index; })
+            .description("Index of the streamed frame since the playback started");
+        builder.get("frame", [](auto &object) { return object.frame; }).description("Simulation frame rendered");
+        builder.get("timestamp", [](auto &object) { return object.timestamp; })
+            .description("Simulation time of the frame rendered");
+        return builder.build();
+    }
+};
+
+struct PlaySimulationResult
+{
+    size_t frame_count = 0;
+    uint32_t last_frame = 0;
+};
+
+template<>
+struct JsonAdapter<PlaySimulationResult> : ObjectAdapter<PlaySimulationResult>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("PlaySimulationResult");
+        builder.get("frame_count", [](auto &object) { return object.frame_count; })
+            .description("Number of frames streamed");
+        builder.get("last_frame", [](auto &object) { return object.last_frame; })
+            .description("Last simulation frame rendered");
+        return builder.build();
+    }
+};
+
+struct SimulationPlaybackParams
+{
+    std::optional<bool> paused;
+    std::optional<uint32_t> frame;
+    std::optional<double> speed;
+};
+
+template<>
+struct JsonAdapter<SimulationPlaybackParams> : ObjectAdapter<SimulationPlaybackParams>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("SimulationPlaybackParams");
+        builder
+            .getset(
+                "paused",
+                [](auto &object) -> auto & { return object.paused; },
+                [](auto &object, const auto &value) { object.paused = value; })
+            .description("Pause or resume the playback")
+            .required(false);
+        builder
+            .getset(
+                "frame",
+                [](auto &object) -> auto & { return object.frame; },
+                [](auto &object, const auto &value) { object.frame = value; })
+            .description("Seek the given frame, must be in playback range")
+            .required(false);
+        builder
+            .getset(
+                "speed",
+                [](auto &object) -> auto & { return object.speed; },
+                [](auto &object, const auto &value) { object.speed = value; })
+            .description("Simulation frames advanced per streamed frame, negative to play backward")
+            .required(false);
+        return builder.build();
+    }
+};
+
+struct SimulationPlaybackState
+{
+    bool playing = false;
+    bool paused = false;
+    uint32_t frame = 0;
+    double speed = 0.0;
+    uint32_t start_frame = 0;
+    uint32_t end_frame = 0;
+};
+
+template<>
+struct JsonAdapter<SimulationPlaybackState> : ObjectAdapter<SimulationPlaybackState>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("SimulationPlaybackState");
+        builder.get("playing", [](auto &object) { return object.playing; })
+            .description("Check if a playback is running");
+        builder.get("paused", [](auto &object) { return object.paused; })
+            .description("Check if the playback is paused");
+        builder.get("frame", [](auto &object) { return object.frame; })
+            .description("Current simulation frame of the playback");
+        builder.get("speed", [](auto &object) { return object.speed; })
+            .description("Simulation frames advanced per streamed frame");
+        builder.get("start_frame", [](auto &object) { return object.start_frame; })
+            .description("First frame of the playback");
+        builder.get("end_frame", [](auto &object) { return object.end_frame; })
+            .description("Last frame of the playback");
+        return builder.build();
+    }
+};
+} // namespace brayns
@@ -28,6 +28,7 @@ namespace brayns
 struct ProgressiveFrameMessage
 {
     uint32_t scale = 0;
+    uint32_t target_frame_time = 33;
 };
 
 template<>
@@ -41,9 +42,19 @@ struct JsonAdapter<ProgressiveFrameMessage> : ObjectAdapter<ProgressiveFrameMess
                 "scale",
                 [](auto &object) { return object.scale; },
                 [](auto &object, auto value) { object.scale = value; })
-            .description("Frame size reduction factor")
+            .description("Max frame size reduction factor")
             .minimum(1)
             .defaultValue(4);
+        builder
+            .getset(
+                "target_frame_time",
+                [](auto &object) { return object.target_frame_time; },
+                [](auto &object, auto value) { object.target_frame_time = value; })
+            .description(
+                "Target render time in milliseconds of the first frame after a change, used to adapt the resolution "
+                "(0 to always render one frame at max reduction before switching to full resolution)")
+            .required(false)
+            .defaultValue(33);
         return builder.build();
     }
 };
@@ -42,6 +42,7 @@ struct SnapshotParams
     uint32_t simulation_frame;
     std::string file_path;
     std::optional<ImageMetadata> metadata;
+    uint32_t tile_size = 0;
 };
 
 template<>
@@ -120,6 +121,15 @@ struct JsonAdapter<SnapshotParams> : ObjectAdapter<SnapshotParams>
                 [](auto &object, auto value) { object.metadata = std::move(value); })
             .description("Metadata information to embed into the image")
             .required(false);
+        builder
+            .getset(
+                "tile_size",
+                [](auto &object) { return object.tile_size; },
+                [](auto &object, auto value) { object.tile_size = value; })
+            .description(
+                "If not zero, render the image by tiles of this size in pixels (at least 128) to bound memory usage, "
+                "only supports PNG and EXR formats")
+            .required(false);
         return builder.build();
     }
 };
@@ -0,0 +1,167 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/json/Json.h>
+
+#include <brayns/engine/json/adapters/EngineObjectDataAdapter.h>
+#include <brayns/engine/json/adapters/ViewAdapter.h>
+#include <brayns/network/adapters/ImageMetadataAdapter.h>
+#include <brayns/network/jsonrpc/RequestId.h>
+#include <brayns/network/messages/ImageSettingsMessage.h>
+
+namespace brayns
+{
+struct SnapshotSequenceParams
+{
+    ImageSettings image_settings;
+    EngineObjectData camera;
+    std::vector<View> camera_views;
+    float camera_near_clip = 0.0f;
+    Vector2f image_start = {0, 1};
+    Vector2f image_end = {1, 0};
+    EngineObjectData renderer;
+    std::vector<uint32_t> simulation_frames;
+    std::string folder;
+    std::optional<ImageMetadata> metadata;
+};
+
+template<>
+struct JsonAdapter<SnapshotSequenceParams> : ObjectAdapter<SnapshotSequenceParams>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("SnapshotSequenceParams");
+        builder
+            .getset(
+                "image_settings",
+                [](auto &object) -> auto & { return object.image_settings; },
+                [](auto &object, auto value) { object.image_settings = std::move(value); })
+            .description("Image settings")
+            .required(false);
+        builder
+            .getset(
+                "camera",
+                [](auto &object) -> auto & { return object.camera; },
+                [](auto &object, const auto &value) { object.camera = value; })
+            .description("Camera definition")
+            .required(false);
+        builder
+            .getset(
+                "camera_views",
+                [](auto &object) -> auto & { return object.camera_views; },
+                [](auto &object, auto value) { object.camera_views = std::move(value); })
+            .description("Camera view of each frame, current view is used for all frames if empty")
+            .required(false);
+        builder
+            .getset(
+                "camera_near_clip",
+                [](auto &object) -> auto & { return object.camera_near_clip; },
+                [](auto &object, const auto &value) { object.camera_near_clip = value; })
+            .description("Camera near clipping distance")
+            .required(false);
+        builder
+            .getset(
+                "image_start",
+                [](auto &object) -> auto & { return object.image_start; },
+                [](auto &object, const auto &value) { object.image_start = value; })
+            .description("Image region start XY normalized")
+            .required(false);
+        builder
+            .getset(
+                "image_end",
+                [](auto &object) -> auto & { return object.image_end; },
+                [](auto &object, const auto &value) { object.image_end = value; })
+            .description("Image region end XY normalized")
+            .required(false);
+        builder
+            .getset(
+                "renderer",
+                [](auto &object) -> auto & { return object.renderer; },
+                [](auto &object, const auto &value) { object.renderer = value; })
+            .description("Renderer definition")
+            .required(false);
+        builder
+            .getset(
+                "simulation_frames",
+                [](auto &object) -> auto & { return object.simulation_frames; },
+                [](auto &object, auto value) { object.simulation_frames = std::move(value); })
+            .description("Simulation frame of each frame, current frame is used for all frames if empty")
+            .required(false);
+        builder
+            .getset(
+                "folder",
+                [](auto &object) -> auto & { return object.folder; },
+                [](auto &object, auto value) { object.folder = std::move(value); })
+            .description("Folder to save the frames as 00000.format, frames are streamed as binary notifications if empty")
+            .required(false);
+        builder
+            .getset(
+                "metadata",
+                [](auto &object) -> auto & { return object.metadata; },
+                [](auto &object, auto value) { object.metadata = std::move(value); })
+            .description("Metadata information to embed into the images")
+            .required(false);
+        return builder.build();
+    }
+};
+
+struct SnapshotSequenceFrame
+{
+    RequestId id;
+    size_t index = 0;
+};
+
+template<>
+struct JsonAdapter<SnapshotSequenceFrame> : ObjectAdapter<SnapshotSequenceFrame>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("SnapshotSequenceFrame");
+        builder
+            .get(
+                "id",
+                [](auto &object) -> auto & { return object.id; })
+            .description("ID of the snapshot-sequence request");
+        builder.get("index", [](auto &object) { return object.index; })
+            .description("Index of the frame in the sequence, encoded in the attached binary");
+        return builder.build();
+    }
+};
+
+struct SnapshotSequenceResult
+{
+    size_t frame_count = 0;
+};
+
+template<>
+struct JsonAdapter<SnapshotSequenceResult> : ObjectAdapter<SnapshotSequenceResult>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("SnapshotSequenceResult");
+        builder.get("frame_count", [](auto &object) { return object.frame_count; })
+            .description("Number of frames rendered, streamed before the reply if no folder was given");
+        return builder.build();
+    }
+};
+} // namespace brayns
@@ -41,10 +41,22 @@ void ApplicationParameters::setWindowSize(const Vector2ui &size) noexcept
     _windowSize = size;
 }
 
+bool ApplicationParameters::isRenderThreadEnabled() const noexcept
+{
+    return _renderThread;
+}
+
+size_t ApplicationParameters::getThreadCount() const noexcept
+{
+    return _threadCount;
+}
+
 void ApplicationParameters::build(ArgvBuilder &builder)
 {
     builder.add("plugin", _plugins, "Plugins libraries to load").composable();
     builder.add("log-level", _logLevel, "Log level");
     builder.add("window-size", _windowSize, "Viewport size").minimum(64);
+    builder.add("render-thread", _renderThread, "Render accumulation frames continuously on a dedicated thread");
+    builder.add("thread-count", _threadCount, "Worker threads for loading and encoding (0 = hardware concurrency)");
 }
 } // namespace brayns
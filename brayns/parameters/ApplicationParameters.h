@@ -61,6 +61,25 @@ public:
      */
     void setWindowSize(const Vector2ui &size) noexcept;
 
+    /**
+     * @brief Check if accumulation frames are rendered continuously on a dedicated thread.
+     *
+     * Default: false.
+     *
+     * @return true Render thread enabled.
+     * @return false Frames are rendered only on render-image requests.
+     */
+    bool isRenderThreadEnabled() const noexcept;
+
+    /**
+     * @brief Get the number of worker threads of the shared thread pool used for loading and encoding.
+     *
+     * Default: 0 (hardware concurrency).
+     *
+     * @return size_t Worker thread count.
+     */
+    size_t getThreadCount() const noexcept;
+
     /**
      * @brief Register argv properties of the parameter set.
      *
@@ -72,5 +91,7 @@ private:
     std::vector<std::string> _plugins;
     LogLevel _logLevel = LogLevel::Info;
     Vector2ui _windowSize = {800, 600};
+    bool _renderThread = false;
+    size_t _threadCount = 0;
 };
 } // namespace brayns
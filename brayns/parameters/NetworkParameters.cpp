@@ -48,6 +48,11 @@ std::chrono::milliseconds NetworkParameters::getReconnectionPeriod() const noexc
     return std::chrono::milliseconds(_reconnectionPeriod);
 }
 
+std::chrono::milliseconds NetworkParameters::getProgressPeriod() const noexcept
+{
+    return std::chrono::milliseconds(_progressPeriod);
+}
+
 const std::string &NetworkParameters::getPrivateKeyFile() const noexcept
 {
     return _privateKeyFile;
@@ -75,6 +80,7 @@ void NetworkParameters::build(ArgvBuilder &builder)
     builder.add("max-clients", _maxClients, "Max simultaneous connections");
     builder.add("uri", _uri, "Server URI (host:port)");
     builder.add("reconnection-period", _reconnectionPeriod, "Client mode reconnection period in ms").minimum(0.0);
+    builder.add("progress-period", _progressPeriod, "Render progress notification period in ms").minimum(1.0);
     builder.add("private-key-file", _privateKeyFile, "Private key file path if secure");
     builder.add("private-key-passphrase", _privateKeyPassphrase, "Private key password if any");
     builder.add("certificate-file", _certificateFile, "Server or client certificate");
@@ -80,6 +80,15 @@ public:
      */
     std::chrono::milliseconds getReconnectionPeriod() const noexcept;
 
+    /**
+     * @brief Get the delay between two progress notifications of long running tasks (renders).
+     *
+     * Default: 1000ms.
+     *
+     * @return std::chrono::milliseconds Progress period.
+     */
+    std::chrono::milliseconds getProgressPeriod() const noexcept;
+
     /**
      * @brief Get the path of the server private key (server + SSL).
      *
@@ -123,6 +132,7 @@ private:
     size_t _maxClients = 2;
     std::string _uri;
     int64_t _reconnectionPeriod = 300;
+    int64_t _progressPeriod = 1000;
     std::string _privateKeyFile;
     std::string _privateKeyPassphrase;
     std::string _certificateFile;
@@ -0,0 +1,342 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "Quantizer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BRAYNS_QUANTIZER_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+struct QuantizationRange
+{
+    float start;
+    float end;
+    float invFactor;
+
+    static QuantizationRange from(const brayns::Vector2f &range)
+    {
+        auto extent = std::fabs(range.y - range.x);
+        return {range.x, range.y, extent > 0.f ? 1.f / extent : 0.f};
+    }
+};
+
+class ScalarKernel
+{
+public:
+    static void quantize(const float *values, size_t count, const QuantizationRange &range, uint8_t *indices)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            indices[i] = _quantize(values[i], range);
+        }
+    }
+
+    static void gather(
+        const float *values,
+        const size_t *offsets,
+        size_t count,
+        const QuantizationRange &range,
+        uint8_t *indices)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            indices[i] = _quantize(values[offsets[i]], range);
+        }
+    }
+
+private:
+    static uint8_t _quantize(float value, const QuantizationRange &range)
+    {
+        value = value > range.end ? range.end : (value < range.start ? range.start : value);
+        auto normalized = (value - range.start) * range.invFactor;
+        return static_cast<uint8_t>(normalized * 255.f);
+    }
+};
+
+#ifdef BRAYNS_QUANTIZER_X86
+// GCC reports the self-initialized undefined vectors of the AVX-512 intrinsics as maybe uninitialized
+#if !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+class Avx2Kernel
+{
+public:
+    __attribute__((target("avx2"))) static void quantize(
+        const float *values,
+        size_t count,
+        const QuantizationRange &range,
+        uint8_t *indices)
+    {
+        auto vectorCount = count - count % 8;
+
+        for (size_t i = 0; i < vectorCount; i += 8)
+        {
+            auto vector = _mm256_loadu_ps(values + i);
+            _store(vector, range, indices + i);
+        }
+
+        ScalarKernel::quantize(values + vectorCount, count - vectorCount, range, indices + vectorCount);
+    }
+
+    __attribute__((target("avx2"))) static void gather(
+        const float *values,
+        const size_t *offsets,
+        size_t count,
+        const QuantizationRange &range,
+        uint8_t *indices)
+    {
+        auto vectorCount = count - count % 8;
+
+        for (size_t i = 0; i < vectorCount; i += 8)
+        {
+            auto lowOffsets = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offsets + i));
+            auto highOffsets = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offsets + i + 4));
+            auto low = _mm256_i64gather_ps(values, lowOffsets, 4);
+            auto high = _mm256_i64gather_ps(values, highOffsets, 4);
+            _store(_mm256_set_m128(high, low), range, indices + i);
+        }
+
+        ScalarKernel::gather(values, offsets + vectorCount, count - vectorCount, range, indices + vectorCount);
+    }
+
+private:
+    __attribute__((target("avx2"))) static void _store(__m256 vector, const QuantizationRange &range, uint8_t *indices)
+    {
+        auto start = _mm256_set1_ps(range.start);
+        vector = _mm256_min_ps(_mm256_max_ps(vector, start), _mm256_set1_ps(range.end));
+        vector = _mm256_mul_ps(_mm256_sub_ps(vector, start), _mm256_set1_ps(range.invFactor));
+        vector = _mm256_mul_ps(vector, _mm256_set1_ps(255.f));
+
+        auto integers = _mm256_cvttps_epi32(vector);
+        auto low = _mm256_castsi256_si128(integers);
+        auto high = _mm256_extracti128_si256(integers, 1);
+        auto words = _mm_packus_epi32(low, high);
+        auto bytes = _mm_packus_epi16(words, words);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(indices), bytes);
+    }
+};
+
+class Avx512Kernel
+{
+public:
+    __attribute__((target("avx512f"))) static void quantize(
+        const float *values,
+        size_t count,
+        const QuantizationRange &range,
+        uint8_t *indices)
+    {
+        auto vectorCount = count - count % 16;
+
+        for (size_t i = 0; i < vectorCount; i += 16)
+        {
+            auto vector = _mm512_loadu_ps(values + i);
+            _store(vector, range, indices + i);
+        }
+
+        ScalarKernel::quantize(values + vectorCount, count - vectorCount, range, indices + vectorCount);
+    }
+
+    __attribute__((target("avx512f"))) static void gather(
+        const float *values,
+        const size_t *offsets,
+        size_t count,
+        const QuantizationRange &range,
+        uint8_t *indices)
+    {
+        auto vectorCount = count - count % 16;
+
+        for (size_t i = 0; i < vectorCount; i += 16)
+        {
+            auto low = _mm512_i64gather_ps(_mm512_loadu_si512(offsets + i), values, 4);
+            auto high = _mm512_i64gather_ps(_mm512_loadu_si512(offsets + i + 8), values, 4);
+            auto merged = _mm512_castsi256_si512(_mm256_castps_si256(low));
+            merged = _mm512_inserti64x4(merged, _mm256_castps_si256(high), 1);
+            _store(_mm512_castsi512_ps(merged), range, indices + i);
+        }
+
+        ScalarKernel::gather(values, offsets + vectorCount, count - vectorCount, range, indices + vectorCount);
+    }
+
+private:
+    __attribute__((target("avx512f"))) static void _store(
+        __m512 vector,
+        const QuantizationRange &range,
+        uint8_t *indices)
+    {
+        auto start = _mm512_set1_ps(range.start);
+        vector = _mm512_min_ps(_mm512_max_ps(vector, start), _mm512_set1_ps(range.end));
+        vector = _mm512_mul_ps(_mm512_sub_ps(vector, start), _mm512_set1_ps(range.invFactor));
+        vector = _mm512_mul_ps(vector, _mm512_set1_ps(255.f));
+
+        auto bytes = _mm512_cvtepi32_epi8(_mm512_cvttps_epi32(vector));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(indices), bytes);
+    }
+};
+
+#if !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+struct QuantizationKernel
+{
+    using Quantize = void (*)(const float *, size_t, const QuantizationRange &, uint8_t *);
+    using Gather = void (*)(const float *, const size_t *, size_t, const QuantizationRange &, uint8_t *);
+
+    std::string name;
+    Quantize quantize;
+    Gather gather;
+};
+
+class KernelSelector
+{
+public:
+    static const QuantizationKernel &get()
+    {
+        return *_current();
+    }
+
+    static const std::vector<QuantizationKernel> &getAvailable()
+    {
+        static const auto kernels = _listAvailable();
+        return kernels;
+    }
+
+    static void select(const std::string &name)
+    {
+        auto &kernels = getAvailable();
+        auto it = std::find_if(kernels.begin(), kernels.end(), [&](auto &kernel) { return kernel.name == name; });
+        if (it == kernels.end())
+        {
+            throw std::invalid_argument("Quantization kernel '" + name + "' is not supported by the host CPU");
+        }
+        _current() = &*it;
+    }
+
+private:
+    static std::atomic<const QuantizationKernel *> &_current()
+    {
+        // Available kernels are sorted from the fastest to the slowest
+        static auto current = std::atomic<const QuantizationKernel *>(&getAvailable().front());
+        return current;
+    }
+
+    static std::vector<QuantizationKernel> _listAvailable()
+    {
+        auto kernels = std::vector<QuantizationKernel>();
+#ifdef BRAYNS_QUANTIZER_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            kernels.push_back({"avx512", &Avx512Kernel::quantize, &Avx512Kernel::gather});
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            kernels.push_back({"avx2", &Avx2Kernel::quantize, &Avx2Kernel::gather});
+        }
+#endif
+        kernels.push_back({"scalar", &ScalarKernel::quantize, &ScalarKernel::gather});
+        return kernels;
+    }
+};
+
+class ChunkedExecutor
+{
+public:
+    static inline constexpr size_t chunkSize = size_t(1) << 16;
+
+    template<typename Callable>
+    static void execute(size_t count, Callable &&callable)
+    {
+        auto chunkCount = (count + chunkSize - 1) / chunkSize;
+
+#pragma omp parallel for if (chunkCount > 1)
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            auto begin = i * chunkSize;
+            auto size = std::min(chunkSize, count - begin);
+            callable(begin, size);
+        }
+    }
+};
+}
+
+namespace brayns
+{
+void Quantizer::quantize(const std::vector<float> &values, const Vector2f &range, std::vector<uint8_t> &indices)
+{
+    indices.resize(values.size());
+
+    auto &kernel = KernelSelector::get();
+    auto quantizationRange = QuantizationRange::from(range);
+
+    ChunkedExecutor::execute(
+        values.size(),
+        [&](size_t begin, size_t size)
+        { kernel.quantize(values.data() + begin, size, quantizationRange, indices.data() + begin); });
+}
+
+void Quantizer::gatherQuantize(
+    const std::vector<float> &values,
+    const std::vector<size_t> &offsets,
+    const Vector2f &range,
+    std::vector<uint8_t> &indices)
+{
+    indices.resize(offsets.size());
+
+    auto &kernel = KernelSelector::get();
+    auto quantizationRange = QuantizationRange::from(range);
+
+    ChunkedExecutor::execute(
+        offsets.size(),
+        [&](size_t begin, size_t size)
+        { kernel.gather(values.data(), offsets.data() + begin, size, quantizationRange, indices.data() + begin); });
+}
+
+std::string Quantizer::getKernelName()
+{
+    return KernelSelector::get().name;
+}
+
+std::vector<std::string> Quantizer::getAvailableKernels()
+{
+    auto names = std::vector<std::string>();
+    for (const auto &kernel : KernelSelector::getAvailable())
+    {
+        names.push_back(kernel.name);
+    }
+    return names;
+}
+
+void Quantizer::setKernel(const std::string &name)
+{
+    KernelSelector::select(name);
+}
+}
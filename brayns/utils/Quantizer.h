@@ -0,0 +1,86 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/utils/MathTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace brayns
+{
+/**
+ * @brief Kernels to quantize floating point values into 8 bit colormap indices in a [min, max] range.
+ *
+ * The implementation (AVX-512, AVX2 or scalar) is selected at runtime from the host CPU features, and large inputs are
+ * processed in parallel chunks.
+ */
+class Quantizer
+{
+public:
+    /**
+     * @brief Computes indices[i] = quantize(values[i]), indices is resized to match values.
+     *
+     * @param values Values to quantize.
+     * @param range Values range, values outside are clamped.
+     * @param indices Output buffer.
+     */
+    static void quantize(const std::vector<float> &values, const Vector2f &range, std::vector<uint8_t> &indices);
+
+    /**
+     * @brief Computes indices[i] = quantize(values[offsets[i]]), indices is resized to match offsets.
+     *
+     * @param values Values to quantize.
+     * @param offsets Offset of the value to quantize for each index, must be in bounds.
+     * @param range Values range, values outside are clamped.
+     * @param indices Output buffer.
+     */
+    static void gatherQuantize(
+        const std::vector<float> &values,
+        const std::vector<size_t> &offsets,
+        const Vector2f &range,
+        std::vector<uint8_t> &indices);
+
+    /**
+     * @brief Returns the name of the implementation selected for the host CPU (avx512, avx2 or scalar).
+     *
+     * @return std::string
+     */
+    static std::string getKernelName();
+
+    /**
+     * @brief Returns the names of the implementations supported by the host CPU, from the fastest to the slowest.
+     *
+     * @return std::vector<std::string>
+     */
+    static std::vector<std::string> getAvailableKernels();
+
+    /**
+     * @brief Overrides the implementation selected at startup, mostly to compare them in tests and benchmarks.
+     *
+     * @param name Name of the implementation to use.
+     * @throw std::invalid_argument Implementation not supported by the host CPU.
+     */
+    static void setKernel(const std::string &name);
+};
+}
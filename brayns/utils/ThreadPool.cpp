@@ -0,0 +1,185 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace
+{
+struct CurrentWorker
+{
+    const void *pool = nullptr;
+    size_t index = 0;
+};
+
+thread_local auto currentWorker = CurrentWorker();
+
+class WorkerCount
+{
+public:
+    static size_t resolve(size_t workerCount)
+    {
+        if (workerCount > 0)
+        {
+            return workerCount;
+        }
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+};
+
+std::atomic<size_t> defaultWorkerCount = 0;
+}
+
+namespace brayns
+{
+ThreadPool::ThreadPool(size_t workerCount)
+{
+    workerCount = WorkerCount::resolve(workerCount);
+
+    _queues.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        _queues.push_back(std::make_unique<TaskQueue>());
+    }
+
+    _workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        _workers.emplace_back([this, i] { _run(i); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        auto lock = std::lock_guard(_mutex);
+        _running = false;
+    }
+    _condition.notify_all();
+    for (auto &worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::getWorkerCount() const noexcept
+{
+    return _workers.size();
+}
+
+void ThreadPool::setDefaultWorkerCount(size_t workerCount) noexcept
+{
+    defaultWorkerCount = workerCount;
+}
+
+ThreadPool &ThreadPool::getDefault()
+{
+    static auto pool = ThreadPool(defaultWorkerCount);
+    return pool;
+}
+
+void ThreadPool::_push(Task task)
+{
+    auto index = currentWorker.pool == this ? currentWorker.index : _next++ % _queues.size();
+
+    auto &queue = *_queues[index];
+    {
+        auto lock = std::lock_guard(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    {
+        auto lock = std::lock_guard(_mutex);
+        ++_pending;
+    }
+    _condition.notify_one();
+}
+
+void ThreadPool::_run(size_t index)
+{
+    currentWorker = {this, index};
+
+    while (true)
+    {
+        {
+            auto lock = std::unique_lock(_mutex);
+            _condition.wait(lock, [this] { return !_running || _pending > 0; });
+
+            if (_pending == 0)
+            {
+                break;
+            }
+
+            // Claims a queued task, so at least one is available to this worker until it takes one
+            --_pending;
+        }
+
+        auto task = _take(index);
+        task();
+    }
+}
+
+ThreadPool::Task ThreadPool::_take(size_t index)
+{
+    while (true)
+    {
+        if (auto task = _popBack(index))
+        {
+            return std::move(*task);
+        }
+
+        auto count = _queues.size();
+        for (size_t i = 1; i < count; ++i)
+        {
+            if (auto task = _popFront((index + i) % count))
+            {
+                return std::move(*task);
+            }
+        }
+    }
+}
+
+std::optional<ThreadPool::Task> ThreadPool::_popBack(size_t index)
+{
+    auto &queue = *_queues[index];
+    auto lock = std::lock_guard(queue.mutex);
+    if (queue.tasks.empty())
+    {
+        return std::nullopt;
+    }
+    auto task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return task;
+}
+
+std::optional<ThreadPool::Task> ThreadPool::_popFront(size_t index)
+{
+    auto &queue = *_queues[index];
+    auto lock = std::lock_guard(queue.mutex);
+    if (queue.tasks.empty())
+    {
+        return std::nullopt;
+    }
+    auto task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return task;
+}
+}
@@ -0,0 +1,131 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace brayns
+{
+/**
+ * @brief Fixed size pool of worker threads with one task queue per worker.
+ *
+ * Tasks submitted from outside the pool are distributed round robin, tasks submitted from a worker go to its own
+ * queue. Workers run their own tasks last in first out and steal the oldest tasks of the other queues when they run
+ * out of work, so a task that fans out keeps every worker busy without oversubscribing the machine.
+ *
+ * Tasks must not block waiting for other tasks of the same pool, as all workers could end up waiting. Submitting
+ * continuations from a task is safe.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Starts the workers.
+     *
+     * @param workerCount Number of worker threads, 0 to use the hardware concurrency.
+     */
+    explicit ThreadPool(size_t workerCount = 0);
+
+    /**
+     * @brief Runs the remaining tasks and stops the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool &operator=(ThreadPool &&) = delete;
+
+    /**
+     * @brief Get the number of worker threads.
+     *
+     * @return size_t Worker count.
+     */
+    size_t getWorkerCount() const noexcept;
+
+    /**
+     * @brief Queues a callable to be run by a worker.
+     *
+     * @tparam Callable Callable type with no arguments.
+     * @param callable Task to run.
+     * @return std::future<R> Future holding the result or the exception thrown by the task.
+     */
+    template<typename Callable>
+    auto submit(Callable callable) -> std::future<std::invoke_result_t<Callable>>
+    {
+        using Result = std::invoke_result_t<Callable>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::move(callable));
+        auto future = task->get_future();
+        _push([task = std::move(task)] { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Set the worker count of the default pool, must be called before its first use.
+     *
+     * @param workerCount Number of worker threads, 0 to use the hardware concurrency.
+     */
+    static void setDefaultWorkerCount(size_t workerCount) noexcept;
+
+    /**
+     * @brief Returns the process wide pool shared by the core and the plugins, created on first use.
+     *
+     * @return ThreadPool& Default pool.
+     */
+    static ThreadPool &getDefault();
+
+private:
+    using Task = std::function<void()>;
+
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void _push(Task task);
+    void _run(size_t index);
+    Task _take(size_t index);
+    std::optional<Task> _popBack(size_t index);
+    std::optional<Task> _popFront(size_t index);
+
+private:
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    std::atomic<size_t> _next = 0;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    size_t _pending = 0;
+    bool _running = true;
+    std::vector<std::thread> _workers;
+};
+}
@@ -49,4 +49,9 @@ int64_t Timer::seconds() const noexcept
 {
     return getDuration<std::ratio<1, 1>>(_startTime);
 }
+
+int64_t Timer::millis() const noexcept
+{
+    return getDuration<std::milli>(_startTime);
+}
 } // namespace brayns
@@ -53,6 +53,12 @@ public:
      */
     int64_t seconds() const noexcept;
 
+    /**
+     * @brief millis returns the time passed, in milliseconds, since the start time point and now (rounded down)
+     * @return milliseconds
+     */
+    int64_t millis() const noexcept;
+
 private:
     using clock = std::chrono::high_resolution_clock;
 
@@ -0,0 +1,52 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ImageStreamWriter.h"
+
+#include <stdexcept>
+
+#include "codecs/ExrStreamWriter.h"
+#include "codecs/PngStreamWriter.h"
+
+namespace brayns
+{
+bool ImageStreamWriterFactory::isSupported(const std::string &format)
+{
+    return format == "png" || format == "exr";
+}
+
+std::unique_ptr<ImageStreamWriter> ImageStreamWriterFactory::create(
+    std::ostream &stream,
+    const ImageInfo &info,
+    const std::string &format,
+    const std::optional<ImageMetadata> &metadata)
+{
+    if (format == "png")
+    {
+        return std::make_unique<PngStreamWriter>(stream, info, metadata);
+    }
+    if (format == "exr")
+    {
+        return std::make_unique<ExrStreamWriter>(stream, info);
+    }
+    throw std::runtime_error("Image format '" + format + "' cannot be encoded as a stream");
+}
+} // namespace brayns
@@ -0,0 +1,94 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include "Image.h"
+#include "ImageMetadata.h"
+
+namespace brayns
+{
+/**
+ * @brief Abstract encoder writing an image to a stream row by row.
+ *
+ * Only the rows being written need to be in memory, which allows to encode
+ * images too large to be stored in a single buffer.
+ *
+ */
+class ImageStreamWriter
+{
+public:
+    virtual ~ImageStreamWriter() = default;
+
+    /**
+     * @brief Append the given rows below the ones already written.
+     *
+     * @param rows Rows with the same width, channels and data type as the output.
+     * @throw std::invalid_argument Rows don't match the output or overflow it.
+     */
+    virtual void write(const Image &rows) = 0;
+
+    /**
+     * @brief Flush the encoder once all the rows have been written.
+     *
+     * @throw std::runtime_error Some rows are missing or the stream failed.
+     */
+    virtual void finish() = 0;
+};
+
+/**
+ * @brief Create image stream writers from the output format.
+ *
+ */
+class ImageStreamWriterFactory
+{
+public:
+    /**
+     * @brief Check if the given format can be encoded as a stream.
+     *
+     * @param format Image format (extension without dot).
+     * @return true Format supported (png, exr).
+     * @return false Format not supported.
+     */
+    static bool isSupported(const std::string &format);
+
+    /**
+     * @brief Create a writer encoding an image with the given properties.
+     *
+     * @param stream Output stream, must outlive the writer and be seekable for EXR.
+     * @param info Output image info (size, channels and data type).
+     * @param format Image format (extension without dot).
+     * @param metadata Metadata to embed into the image if supported.
+     * @return std::unique_ptr<ImageStreamWriter> Image writer.
+     * @throw std::runtime_error Unsupported format or image info.
+     */
+    static std::unique_ptr<ImageStreamWriter> create(
+        std::ostream &stream,
+        const ImageInfo &info,
+        const std::string &format,
+        const std::optional<ImageMetadata> &metadata = std::nullopt);
+};
+} // namespace brayns
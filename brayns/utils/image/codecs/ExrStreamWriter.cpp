@@ -0,0 +1,362 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ExrStreamWriter.h"
+
+#include <brayns/utils/binary/ByteConverter.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+// https://openexr.com/en/latest/OpenEXRFileLayout.html
+struct ExrConstants
+{
+    static constexpr uint32_t magic = 20000630;
+    static constexpr uint32_t version = 2;
+    static constexpr uint8_t zipsCompression = 2;
+    static constexpr int32_t uintPixelType = 0;
+    static constexpr int32_t floatPixelType = 2;
+    static inline const std::vector<std::string> channelNames = {"R", "G", "B", "A"};
+};
+
+class ExrInfoValidator
+{
+public:
+    static void validate(const brayns::ImageInfo &info)
+    {
+        if (info.width == 0 || info.height == 0)
+        {
+            throw std::runtime_error("Cannot encode an empty EXR image");
+        }
+        if (info.channelCount == 0 || info.channelCount > ExrConstants::channelNames.size())
+        {
+            throw std::runtime_error("EXR images must have 1 to 4 channels");
+        }
+        if (info.dataType == brayns::ImageDataType::Float && info.channelSize != sizeof(float))
+        {
+            throw std::runtime_error("EXR float channels must be 32 bits");
+        }
+        if (info.channelSize != 1 && info.channelSize != sizeof(uint32_t))
+        {
+            throw std::runtime_error("EXR streaming only supports 8 and 32 bits channels");
+        }
+    }
+};
+
+class ExrChannelOrder
+{
+public:
+    // EXR stores channels sorted by name (A, B, G, R), returns the image channel index of each one
+    static std::vector<size_t> get(size_t channelCount)
+    {
+        auto &names = ExrConstants::channelNames;
+        auto order = std::vector<size_t>(channelCount);
+        for (size_t i = 0; i < channelCount; ++i)
+        {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](auto left, auto right) { return names[left] < names[right]; });
+        return order;
+    }
+};
+
+class ExrSerializer
+{
+public:
+    template<typename T>
+    static void append(T value, std::string &buffer)
+    {
+        buffer += brayns::ByteConverter::convertToBytes(value, std::endian::little);
+    }
+
+    static void append(const std::string &value, std::string &buffer)
+    {
+        buffer += value;
+        buffer.push_back('\0');
+    }
+
+    static void appendAttribute(const std::string &name, const std::string &type, const std::string &value, std::string &buffer)
+    {
+        append(name, buffer);
+        append(type, buffer);
+        append(static_cast<int32_t>(value.size()), buffer);
+        buffer += value;
+    }
+};
+
+class ExrHeader
+{
+public:
+    static std::string build(const brayns::ImageInfo &info)
+    {
+        auto header = std::string();
+        ExrSerializer::append(ExrConstants::magic, header);
+        ExrSerializer::append(ExrConstants::version, header);
+
+        ExrSerializer::appendAttribute("channels", "chlist", _buildChannels(info), header);
+        ExrSerializer::appendAttribute("compression", "compression", _buildCompression(), header);
+        ExrSerializer::appendAttribute("dataWindow", "box2i", _buildWindow(info), header);
+        ExrSerializer::appendAttribute("displayWindow", "box2i", _buildWindow(info), header);
+        ExrSerializer::appendAttribute("lineOrder", "lineOrder", std::string(1, '\0'), header);
+        ExrSerializer::appendAttribute("pixelAspectRatio", "float", _buildFloat(1.0f), header);
+        ExrSerializer::appendAttribute("screenWindowCenter", "v2f", _buildFloat(0.0f) + _buildFloat(0.0f), header);
+        ExrSerializer::appendAttribute("screenWindowWidth", "float", _buildFloat(1.0f), header);
+        header.push_back('\0');
+
+        return header;
+    }
+
+private:
+    static std::string _buildChannels(const brayns::ImageInfo &info)
+    {
+        auto pixelType = info.dataType == brayns::ImageDataType::Float ? ExrConstants::floatPixelType
+                                                                       : ExrConstants::uintPixelType;
+        auto channels = std::string();
+        for (auto index : ExrChannelOrder::get(info.channelCount))
+        {
+            ExrSerializer::append(ExrConstants::channelNames[index], channels);
+            ExrSerializer::append(pixelType, channels);
+            ExrSerializer::append(uint32_t(0), channels); // pLinear + reserved
+            ExrSerializer::append(int32_t(1), channels); // xSampling
+            ExrSerializer::append(int32_t(1), channels); // ySampling
+        }
+        channels.push_back('\0');
+        return channels;
+    }
+
+    static std::string _buildCompression()
+    {
+        return std::string(1, static_cast<char>(ExrConstants::zipsCompression));
+    }
+
+    static std::string _buildWindow(const brayns::ImageInfo &info)
+    {
+        auto window = std::string();
+        ExrSerializer::append(int32_t(0), window);
+        ExrSerializer::append(int32_t(0), window);
+        ExrSerializer::append(static_cast<int32_t>(info.width - 1), window);
+        ExrSerializer::append(static_cast<int32_t>(info.height - 1), window);
+        return window;
+    }
+
+    static std::string _buildFloat(float value)
+    {
+        return brayns::ByteConverter::convertToBytes(value, std::endian::little);
+    }
+};
+
+class ExrScanline
+{
+public:
+    // Channels are stored one after the other (planar) in little endian 32 bits values
+    static void build(const brayns::Image &rows, size_t y, std::string &buffer)
+    {
+        auto width = rows.getWidth();
+        auto channelSize = rows.getChannelSize();
+        auto order = ExrChannelOrder::get(rows.getChannelCount());
+
+        buffer.clear();
+
+        for (auto channel : order)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                auto pixel = static_cast<const char *>(rows.getData(x, y));
+                auto value = _read(pixel + channel * channelSize, channelSize);
+                ExrSerializer::append(value, buffer);
+            }
+        }
+    }
+
+private:
+    static uint32_t _read(const char *data, size_t channelSize)
+    {
+        if (channelSize == 1)
+        {
+            return static_cast<uint8_t>(*data);
+        }
+        auto value = uint32_t(0);
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+};
+
+// Same as OpenEXR ZIP compressor: bytes are split in two halves and delta encoded before deflate
+class ExrZipCompressor
+{
+public:
+    // Returns the raw data if compression doesn't reduce its size (allowed by the format)
+    static const std::string &compress(const std::string &data, std::string &buffer, std::string &output)
+    {
+        _interleave(data, buffer);
+        _predict(buffer);
+
+        auto bound = compressBound(static_cast<uLong>(buffer.size()));
+        output.resize(bound);
+
+        auto destination = reinterpret_cast<Bytef *>(output.data());
+        auto source = reinterpret_cast<const Bytef *>(buffer.data());
+        auto size = bound;
+
+        if (compress2(destination, &size, source, static_cast<uLong>(buffer.size()), Z_DEFAULT_COMPRESSION) != Z_OK)
+        {
+            throw std::runtime_error("Failed to compress EXR scanline");
+        }
+
+        if (size >= data.size())
+        {
+            return data;
+        }
+
+        output.resize(size);
+        return output;
+    }
+
+private:
+    static void _interleave(const std::string &data, std::string &output)
+    {
+        auto size = data.size();
+        output.resize(size);
+
+        auto first = output.data();
+        auto second = output.data() + (size + 1) / 2;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            auto &target = i % 2 == 0 ? first : second;
+            *target = data[i];
+            ++target;
+        }
+    }
+
+    static void _predict(std::string &data)
+    {
+        if (data.empty())
+        {
+            return;
+        }
+
+        auto bytes = reinterpret_cast<uint8_t *>(data.data());
+        auto previous = int(bytes[0]);
+
+        for (size_t i = 1; i < data.size(); ++i)
+        {
+            auto current = int(bytes[i]);
+            bytes[i] = static_cast<uint8_t>(current - previous + (128 + 256));
+            previous = current;
+        }
+    }
+};
+} // namespace
+
+namespace brayns
+{
+ExrStreamWriter::ExrStreamWriter(std::ostream &stream, const ImageInfo &info):
+    _stream(stream),
+    _info(info)
+{
+    ExrInfoValidator::validate(_info);
+
+    _start = _stream.tellp();
+
+    auto header = ExrHeader::build(_info);
+    _stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    _offsetTable = _stream.tellp();
+    _offsets.reserve(_info.height);
+
+    auto table = std::string(_info.height * sizeof(uint64_t), '\0');
+    _stream.write(table.data(), static_cast<std::streamsize>(table.size()));
+}
+
+void ExrStreamWriter::write(const Image &rows)
+{
+    if (rows.getWidth() != _info.width || rows.getPixelSize() != _info.getPixelSize()
+        || rows.getDataType() != _info.dataType)
+    {
+        throw std::invalid_argument("Rows don't match EXR image info");
+    }
+
+    auto height = rows.getHeight();
+
+    if (_offsets.size() + height > _info.height)
+    {
+        throw std::invalid_argument("Too many rows written to EXR image");
+    }
+
+    for (size_t y = 0; y < height; ++y)
+    {
+        _writeRow(rows, y);
+    }
+}
+
+void ExrStreamWriter::finish()
+{
+    if (_finished)
+    {
+        return;
+    }
+
+    if (_offsets.size() != _info.height)
+    {
+        throw std::runtime_error("Missing rows in EXR image");
+    }
+
+    auto end = _stream.tellp();
+
+    auto table = std::string();
+    table.reserve(_offsets.size() * sizeof(uint64_t));
+    for (auto offset : _offsets)
+    {
+        ExrSerializer::append(offset, table);
+    }
+
+    _stream.seekp(_offsetTable);
+    _stream.write(table.data(), static_cast<std::streamsize>(table.size()));
+    _stream.seekp(end);
+    _stream.flush();
+    _finished = true;
+
+    if (!_stream)
+    {
+        throw std::runtime_error("Failed to write EXR image");
+    }
+}
+
+void ExrStreamWriter::_writeRow(const Image &rows, size_t y)
+{
+    auto offset = static_cast<uint64_t>(_stream.tellp() - _start);
+    _offsets.push_back(offset);
+
+    ExrScanline::build(rows, y, _scanline);
+    auto &data = ExrZipCompressor::compress(_scanline, _buffer, _compressed);
+
+    auto chunk = std::string();
+    ExrSerializer::append(static_cast<int32_t>(_offsets.size() - 1), chunk);
+    ExrSerializer::append(static_cast<int32_t>(data.size()), chunk);
+    _stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    _stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+}
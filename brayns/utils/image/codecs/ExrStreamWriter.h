@@ -0,0 +1,70 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/utils/image/ImageStreamWriter.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace brayns
+{
+/**
+ * @brief Streaming single part scanline EXR encoder.
+ *
+ * Each row is stored as a separated ZIPS compressed chunk, the offset table
+ * is reserved in the header and filled once all the rows are written, hence
+ * the output stream must be seekable.
+ *
+ * 32 bits channels are stored as is (UINT or FLOAT), 8 bits ones are widened
+ * to UINT like ExrCodec does.
+ */
+class ExrStreamWriter : public ImageStreamWriter
+{
+public:
+    /**
+     * @brief Write the EXR header to the stream and reserve the offset table.
+     *
+     * @param stream Seekable output stream.
+     * @param info Output image info.
+     * @throw std::runtime_error Unsupported image info.
+     */
+    ExrStreamWriter(std::ostream &stream, const ImageInfo &info);
+
+    void write(const Image &rows) override;
+    void finish() override;
+
+private:
+    void _writeRow(const Image &rows, size_t y);
+
+private:
+    std::ostream &_stream;
+    ImageInfo _info;
+    std::streampos _start;
+    std::streampos _offsetTable;
+    std::vector<uint64_t> _offsets;
+    std::string _scanline;
+    std::string _buffer;
+    std::string _compressed;
+    bool _finished = false;
+};
+}
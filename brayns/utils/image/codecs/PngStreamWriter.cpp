@@ -0,0 +1,278 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "PngStreamWriter.h"
+
+#include <brayns/utils/binary/ByteConverter.h>
+
+#include "StbiHelper.h"
+
+#include <array>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace
+{
+class PngColorType
+{
+public:
+    static uint8_t fromChannelCount(size_t channelCount)
+    {
+        switch (channelCount)
+        {
+        case 1:
+            return 0;
+        case 2:
+            return 4;
+        case 3:
+            return 2;
+        case 4:
+            return 6;
+        }
+        throw std::runtime_error("PNG images must have 1 to 4 channels");
+    }
+};
+
+class PngInfoValidator
+{
+public:
+    static void validate(const brayns::ImageInfo &info)
+    {
+        if (info.width == 0 || info.height == 0)
+        {
+            throw std::runtime_error("Cannot encode an empty PNG image");
+        }
+        if (info.channelSize != 1 || info.dataType != brayns::ImageDataType::UnsignedInt)
+        {
+            throw std::runtime_error("PNG streaming only supports 8bit channels");
+        }
+    }
+};
+
+class PngHeader
+{
+public:
+    static std::string build(const brayns::ImageInfo &info)
+    {
+        auto header = std::string();
+        _append(static_cast<uint32_t>(info.width), header);
+        _append(static_cast<uint32_t>(info.height), header);
+        _append(uint8_t(8), header);
+        _append(PngColorType::fromChannelCount(info.channelCount), header);
+        _append(uint8_t(0), header); // compression method
+        _append(uint8_t(0), header); // filter method
+        _append(uint8_t(0), header); // interlace method
+        return header;
+    }
+
+private:
+    template<typename T>
+    static void _append(T value, std::string &buffer)
+    {
+        buffer += brayns::ByteConverter::convertToBytes(value, std::endian::big);
+    }
+};
+
+// https://www.w3.org/TR/png/#9Filter-type-4-Paeth
+class PaethFilter
+{
+public:
+    static void apply(const std::string &previous, const char *row, size_t pixelSize, std::string &output)
+    {
+        auto size = previous.size();
+        auto current = reinterpret_cast<const uint8_t *>(row);
+        auto up = reinterpret_cast<const uint8_t *>(previous.data());
+
+        output[0] = 4;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            auto a = i < pixelSize ? 0 : int(current[i - pixelSize]);
+            auto b = int(up[i]);
+            auto c = i < pixelSize ? 0 : int(up[i - pixelSize]);
+            auto predictor = _predict(a, b, c);
+            output[i + 1] = static_cast<char>(current[i] - predictor);
+        }
+    }
+
+private:
+    static int _predict(int a, int b, int c)
+    {
+        auto p = a + b - c;
+        auto pa = std::abs(p - a);
+        auto pb = std::abs(p - b);
+        auto pc = std::abs(p - c);
+        if (pa <= pb && pa <= pc)
+        {
+            return a;
+        }
+        if (pb <= pc)
+        {
+            return b;
+        }
+        return c;
+    }
+};
+} // namespace
+
+namespace brayns
+{
+PngStreamWriter::PngStreamWriter(
+    std::ostream &stream,
+    const ImageInfo &info,
+    const std::optional<ImageMetadata> &metadata):
+    _stream(stream),
+    _info(info),
+    _zstream{}
+{
+    PngInfoValidator::validate(_info);
+
+    auto rowSize = _info.getRowSize();
+    _previousRow.assign(rowSize, '\0');
+    _filteredRow.assign(rowSize + 1, '\0');
+    _output.assign(1 << 16, '\0');
+
+    if (deflateInit(&_zstream, Z_DEFAULT_COMPRESSION) != Z_OK)
+    {
+        throw std::runtime_error("Failed to initialize PNG compression");
+    }
+
+    static constexpr auto signature = std::array<uint8_t, 8>{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    _stream.write(reinterpret_cast<const char *>(signature.data()), signature.size());
+
+    auto header = PngHeader::build(_info);
+    _writeChunk("IHDR", header.data(), header.size());
+
+    if (metadata)
+    {
+        auto chunk = StbiHelper::encodePngMetadata(*metadata);
+        _stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    }
+}
+
+PngStreamWriter::~PngStreamWriter()
+{
+    deflateEnd(&_zstream);
+}
+
+void PngStreamWriter::write(const Image &rows)
+{
+    if (rows.getWidth() != _info.width || rows.getPixelSize() != _info.getPixelSize())
+    {
+        throw std::invalid_argument("Rows don't match PNG image info");
+    }
+
+    auto height = rows.getHeight();
+
+    if (_rowCount + height > _info.height)
+    {
+        throw std::invalid_argument("Too many rows written to PNG image");
+    }
+
+    for (size_t y = 0; y < height; ++y)
+    {
+        _writeRow(static_cast<const char *>(rows.getData(0, y)));
+    }
+}
+
+void PngStreamWriter::finish()
+{
+    if (_finished)
+    {
+        return;
+    }
+
+    if (_rowCount != _info.height)
+    {
+        throw std::runtime_error("Missing rows in PNG image");
+    }
+
+    _deflate({}, Z_FINISH);
+    _writeChunk("IEND", nullptr, 0);
+    _stream.flush();
+    _finished = true;
+
+    if (!_stream)
+    {
+        throw std::runtime_error("Failed to write PNG image");
+    }
+}
+
+void PngStreamWriter::_writeRow(const char *row)
+{
+    auto pixelSize = _info.getPixelSize();
+    PaethFilter::apply(_previousRow, row, pixelSize, _filteredRow);
+    _previousRow.assign(row, _previousRow.size());
+    _deflate(_filteredRow, Z_NO_FLUSH);
+    ++_rowCount;
+}
+
+void PngStreamWriter::_deflate(const std::string &data, int flush)
+{
+    _zstream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+    _zstream.avail_in = static_cast<uInt>(data.size());
+
+    while (true)
+    {
+        _zstream.next_out = reinterpret_cast<Bytef *>(_output.data());
+        _zstream.avail_out = static_cast<uInt>(_output.size());
+
+        auto result = deflate(&_zstream, flush);
+
+        if (result == Z_STREAM_ERROR)
+        {
+            throw std::runtime_error("Failed to compress PNG image");
+        }
+
+        auto size = _output.size() - _zstream.avail_out;
+
+        if (size != 0)
+        {
+            _writeChunk("IDAT", _output.data(), size);
+        }
+
+        if (flush == Z_FINISH ? result == Z_STREAM_END : _zstream.avail_out != 0)
+        {
+            return;
+        }
+    }
+}
+
+void PngStreamWriter::_writeChunk(const char *type, const void *data, size_t size)
+{
+    auto length = ByteConverter::convertToBytes(static_cast<uint32_t>(size), std::endian::big);
+    _stream.write(length.data(), static_cast<std::streamsize>(length.size()));
+
+    auto bytes = reinterpret_cast<const Bytef *>(data);
+    auto crc = crc32(0, reinterpret_cast<const Bytef *>(type), 4);
+    if (size > 0)
+    {
+        // crc32 returns 0 instead of the running CRC for a null buffer
+        crc = crc32(crc, bytes, static_cast<uInt>(size));
+    }
+
+    _stream.write(type, 4);
+    _stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+
+    auto checksum = ByteConverter::convertToBytes(static_cast<uint32_t>(crc), std::endian::big);
+    _stream.write(checksum.data(), static_cast<std::streamsize>(checksum.size()));
+}
+} // namespace brayns
@@ -0,0 +1,78 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * Responsible Author: adrien.fleury@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/utils/image/ImageStreamWriter.h>
+
+#include <zlib.h>
+
+#include <string>
+
+namespace brayns
+{
+/**
+ * @brief Streaming PNG encoder.
+ *
+ * Rows are filtered (Paeth) and deflated as they come so only the previous
+ * row and the compression window are kept in memory.
+ *
+ * Only supports 8bit channels images.
+ */
+class PngStreamWriter : public ImageStreamWriter
+{
+public:
+    /**
+     * @brief Write the PNG header (and metadata if any) to the stream.
+     *
+     * @param stream Output stream.
+     * @param info Output image info.
+     * @param metadata Metadata to embed into the image.
+     * @throw std::runtime_error Unsupported image info.
+     */
+    PngStreamWriter(std::ostream &stream, const ImageInfo &info, const std::optional<ImageMetadata> &metadata);
+    ~PngStreamWriter() override;
+
+    PngStreamWriter(const PngStreamWriter &) = delete;
+    PngStreamWriter &operator=(const PngStreamWriter &) = delete;
+
+    PngStreamWriter(PngStreamWriter &&) = delete;
+    PngStreamWriter &operator=(PngStreamWriter &&) = delete;
+
+    void write(const Image &rows) override;
+    void finish() override;
+
+private:
+    void _writeRow(const char *row);
+    void _deflate(const std::string &data, int flush);
+    void _writeChunk(const char *type, const void *data, size_t size);
+
+private:
+    std::ostream &_stream;
+    ImageInfo _info;
+    size_t _rowCount = 0;
+    std::string _previousRow;
+    std::string _filteredRow;
+    std::string _output;
+    z_stream _zstream;
+    bool _finished = false;
+};
+} // namespace brayns
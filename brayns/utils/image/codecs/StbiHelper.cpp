@@ -394,6 +394,11 @@ std::string StbiHelper::encodePng(const Image &image, const std::optional<ImageM
     return StbiPngEncoder::encode(image, metadata);
 }
 
+std::string StbiHelper::encodePngMetadata(const ImageMetadata &metadata)
+{
+    return PngXmpChunkEncoder::encode(metadata);
+}
+
 std::string StbiHelper::encodeJpeg(const Image &image, int quality, const std::optional<ImageMetadata> &metadata)
 {
     return StbiJpegEncoder::encode(image, quality, metadata);
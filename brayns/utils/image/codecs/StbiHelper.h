@@ -60,6 +60,16 @@ public:
      */
     static std::string encodePng(const Image &image, const std::optional<ImageMetadata> &metadata);
 
+    /**
+     * @brief Encode metadata as a PNG XMP chunk.
+     *
+     * The chunk can be inserted anywhere between the IHDR and IEND chunks.
+     *
+     * @param metadata Metadata to encode.
+     * @return std::string PNG iTXt chunk (length, type, data and CRC).
+     */
+    static std::string encodePngMetadata(const ImageMetadata &metadata);
+
     /**
      * @brief Encode an image as JPEG.
      *
@@ -29,6 +29,7 @@
 #include <io/NeuronMorphologyLoader.h>
 #include <io/SonataLoader.h>
 #include <network/entrypoints/GetCircuitIdsEntrypoint.h>
+#include <network/entrypoints/GetReportCacheStatisticsEntrypoint.h>
 #include <network/entrypoints/SetCircuitThicknessEntrypoint.h>
 
 CircuitExplorerPlugin::CircuitExplorerPlugin(brayns::PluginAPI &api)
@@ -54,6 +55,7 @@ CircuitExplorerPlugin::CircuitExplorerPlugin(brayns::PluginAPI &api)
     auto entrypoints = brayns::EntrypointBuilder(name, *interface);
 
     entrypoints.add<GetCircuitIdsEntrypoint>(models);
+    entrypoints.add<GetReportCacheStatisticsEntrypoint>(models);
     entrypoints.add<SetCircuitThicknessEntrypoint>(models);
 }
 
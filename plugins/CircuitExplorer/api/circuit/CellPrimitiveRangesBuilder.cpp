@@ -0,0 +1,56 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "CellPrimitiveRangesBuilder.h"
+
+CellPrimitiveRanges CellPrimitiveRangesBuilder::build(
+    const std::vector<size_t> &cellPrimitiveCounts,
+    size_t maxPrimitivesPerGeometry)
+{
+    auto ranges = CellPrimitiveRanges();
+    auto &cellOffsets = ranges.cellOffsets;
+    auto &geometryCells = ranges.geometryCells;
+
+    cellOffsets.reserve(cellPrimitiveCounts.size() + 1);
+    geometryCells.push_back(0);
+
+    size_t primitiveCount = 0;
+    size_t geometryPrimitiveCount = 0;
+
+    for (size_t i = 0; i < cellPrimitiveCounts.size(); ++i)
+    {
+        auto cellPrimitiveCount = cellPrimitiveCounts[i];
+
+        if (geometryPrimitiveCount > 0 && geometryPrimitiveCount + cellPrimitiveCount > maxPrimitivesPerGeometry)
+        {
+            geometryCells.push_back(i);
+            geometryPrimitiveCount = 0;
+        }
+
+        cellOffsets.push_back(primitiveCount);
+        primitiveCount += cellPrimitiveCount;
+        geometryPrimitiveCount += cellPrimitiveCount;
+    }
+
+    cellOffsets.push_back(primitiveCount);
+    geometryCells.push_back(cellPrimitiveCounts.size());
+
+    return ranges;
+}
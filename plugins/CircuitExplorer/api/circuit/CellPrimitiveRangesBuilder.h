@@ -0,0 +1,40 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <components/CellPrimitiveRanges.h>
+
+/**
+ * @brief Packs consecutive cells in geometries of a maximum primitive count, never splitting a cell across two
+ * geometries.
+ */
+class CellPrimitiveRangesBuilder
+{
+public:
+    /**
+     * @brief Computes the primitive offset of each cell and the cells of each geometry.
+     *
+     * @param cellPrimitiveCounts Number of primitives of each cell, in order.
+     * @param maxPrimitivesPerGeometry Primitive budget of a geometry, a bigger cell gets a geometry for itself.
+     * @return CellPrimitiveRanges Cell and geometry ranges.
+     */
+    static CellPrimitiveRanges build(const std::vector<size_t> &cellPrimitiveCounts, size_t maxPrimitivesPerGeometry);
+};
@@ -19,6 +19,7 @@
  */
 
 #include "MorphologyCircuitBuilder.h"
+#include "CellPrimitiveRangesBuilder.h"
 
 #include <brayns/engine/colormethods/SolidColorMethod.h>
 #include <brayns/engine/components/ColorSolid.h>
@@ -26,9 +27,13 @@
 #include <brayns/engine/systems/GenericBoundsSystem.h>
 #include <brayns/engine/systems/GenericColorSystem.h>
 #include <brayns/engine/systems/GeometryDataSystem.h>
+#include <brayns/utils/ThreadPool.h>
+#include <brayns/utils/Timer.h>
+
+#include <spdlog/fmt/fmt.h>
 
 #include <api/ModelType.h>
-#include <api/coloring/handlers/ComposedColorHandler.h>
+#include <api/coloring/handlers/MergedColorHandler.h>
 #include <api/coloring/methods/BrainDatasetColorMethod.h>
 #include <api/coloring/methods/IdColorMethod.h>
 #include <api/coloring/methods/MorphologySectionTypeColorMethod.h>
@@ -37,13 +42,17 @@
 #include <api/neuron/builders/NeuronCapsuleBuilder.h>
 #include <api/neuron/builders/NeuronSphereBuilder.h>
 #include <components/BrainColorData.h>
+#include <components/CellPrimitiveRanges.h>
 #include <components/CircuitIds.h>
 #include <components/ColorHandler.h>
 #include <components/NeuronSectionType.h>
 #include <systems/NeuronInspectSystem.h>
 
-#include <deque>
+#include <algorithm>
+#include <exception>
 #include <future>
+#include <iterator>
+#include <memory>
 #include <unordered_map>
 
 namespace
@@ -66,12 +75,75 @@ public:
 };
 
 /**
- * @brief Reads the morphology files and transform them into geometry.
+ * @brief Reports the number of cells loaded and the load throughput.
+ */
+class LoadProgress
+{
+public:
+    explicit LoadProgress(ProgressUpdater &updater):
+        _updater(updater)
+    {
+    }
+
+    void update(size_t cellCount)
+    {
+        _cellCount += cellCount;
+        auto seconds = static_cast<double>(std::max<int64_t>(_timer.millis(), 1)) / 1000.0;
+        auto throughput = static_cast<double>(_cellCount) / seconds;
+        _updater.update(cellCount, fmt::format("{:.0f} cells/s", throughput));
+    }
+
+private:
+    ProgressUpdater &_updater;
+    brayns::Timer _timer;
+    size_t _cellCount = 0;
+};
+
+/**
+ * @brief Waits for a task and stores its exception, if any, so all pending tasks can be joined before rethrowing.
+ */
+class TaskJoiner
+{
+public:
+    template<typename T, typename Callback>
+    void join(std::future<T> &task, Callback callback)
+    {
+        try
+        {
+            callback(task.get());
+        }
+        catch (...)
+        {
+            if (!_error)
+            {
+                _error = std::current_exception();
+            }
+        }
+    }
+
+    void rethrow()
+    {
+        if (_error)
+        {
+            std::rethrow_exception(_error);
+        }
+    }
+
+private:
+    std::exception_ptr _error;
+};
+
+/**
+ * @brief Reads the morphology files and transform them into geometry on the shared thread pool.
+ *
+ * Each morphology file is read once, then the cells using it are instantiated in chunks. The first chunk is processed
+ * by the task which read the file and the others are queued as separated tasks that idle workers can steal, so a
+ * morphology shared by many cells does not serialize the load.
  */
 class ParallelMorphologyLoader
 {
 public:
-    static inline constexpr size_t maxThreads = 800;
+    static inline constexpr size_t cellsPerTask = 64;
 
     template<typename PrimitiveType>
     static std::vector<NeuronGeometry<PrimitiveType>> load(
@@ -88,44 +160,90 @@ public:
         auto dendrites = morphologyParameters.load_dendrites;
         auto pipeline = NeuronMorphologyPipeline::fromParameters(morphologyParameters);
 
+        auto &pool = brayns::ThreadPool::getDefault();
+
+        using Geometry = NeuronGeometry<PrimitiveType>;
+        using GeometryBuilder = NeuronGeometryBuilder<PrimitiveType>;
+        using Instantiator = NeuronGeometryInstantiator<PrimitiveType>;
+
+        auto instantiateFn = [&](const Geometry &baseGeometry, const std::vector<size_t> &indices, size_t first)
+        {
+            auto last = std::min(first + cellsPerTask, indices.size());
+            for (auto i = first; i < last; ++i)
+            {
+                auto idx = indices[i];
+                morphologies[idx] = Instantiator::instantiate(baseGeometry, positions[idx], rotations[idx]);
+            }
+
+            // Return the number of cells loaded for the progress updater
+            return last - first;
+        };
+
         auto loadFn = [&](const std::string &path, const std::vector<size_t> &indices)
         {
             auto morphology = NeuronMorphologyReader::read(path, soma, axon, dendrites);
             pipeline.process(morphology);
 
-            auto baseGeometry = NeuronGeometryBuilder<PrimitiveType>::build(morphology);
+            auto baseGeometry = std::make_shared<const Geometry>(GeometryBuilder::build(morphology));
 
-            for (auto idx : indices)
+            // The first chunk runs before the others are queued, so that if it throws there is no pending chunk
+            // referencing local data that the caller would never join
+            auto result = LoadResult();
+            result.cellCount = instantiateFn(*baseGeometry, indices, 0);
+
+            for (auto first = cellsPerTask; first < indices.size(); first += cellsPerTask)
             {
-                morphologies[idx] =
-                    NeuronGeometryInstantiator<PrimitiveType>::instantiate(baseGeometry, positions[idx], rotations[idx]);
+                result.instantiations.push_back(
+                    pool.submit([&, baseGeometry, first] { return instantiateFn(*baseGeometry, indices, first); }));
             }
 
-            // Return the number of cells loaded for the progress updater
-            return indices.size();
+            return result;
         };
 
-        auto loadTasks = std::deque<std::future<std::size_t>>();
+        auto loads = std::vector<std::future<LoadResult>>();
+        loads.reserve(morphologyMap.size());
 
-        for (auto &[path, cellIndices] : morphologyMap)
+        for (auto &entry : morphologyMap)
         {
-            if (loadTasks.size() == maxThreads)
-            {
-                auto &topTask = loadTasks.front();
-                progressUpdater.update(topTask.get());
-                loadTasks.pop_front();
-            }
+            loads.push_back(pool.submit([&] { return loadFn(entry.first, entry.second); }));
+        }
 
-            loadTasks.push_back(std::async(loadFn, path, cellIndices));
+        // All tasks reference local data so they must all be joined even if one fails
+        auto joiner = TaskJoiner();
+        auto progress = LoadProgress(progressUpdater);
+        auto instantiations = std::vector<std::future<size_t>>();
+
+        for (auto &load : loads)
+        {
+            joiner.join(
+                load,
+                [&](LoadResult result)
+                {
+                    auto &pending = result.instantiations;
+                    instantiations.insert(
+                        instantiations.end(),
+                        std::make_move_iterator(pending.begin()),
+                        std::make_move_iterator(pending.end()));
+                    progress.update(result.cellCount);
+                });
         }
 
-        for (auto &task : loadTasks)
+        for (auto &instantiation : instantiations)
         {
-            progressUpdater.update(task.get());
+            joiner.join(instantiation, [&](size_t cellCount) { progress.update(cellCount); });
         }
 
+        joiner.rethrow();
+
         return morphologies;
     }
+
+private:
+    struct LoadResult
+    {
+        size_t cellCount = 0;
+        std::vector<std::future<size_t>> instantiations;
+    };
 };
 
 /**
@@ -160,6 +278,11 @@ public:
         _components.add<NeuronSectionType>(std::move(sections));
     }
 
+    void addCellRanges(CellPrimitiveRanges ranges)
+    {
+        _components.add<CellPrimitiveRanges>(std::move(ranges));
+    }
+
     void addColoring(std::unique_ptr<IBrainColorData> data)
     {
         auto availableMethods = data->getMethods();
@@ -176,7 +299,8 @@ public:
 
         _systems.setColorSystem<brayns::GenericColorSystem>(std::move(colorMethods));
 
-        _components.add<ColorHandler>(std::make_unique<ComposedColorHandler>());
+        auto &ranges = _components.get<CellPrimitiveRanges>();
+        _components.add<ColorHandler>(std::make_unique<MergedColorHandler>(ranges));
         _components.add<BrainColorData>(std::move(data));
     }
 
@@ -200,41 +324,69 @@ private:
 };
 
 /**
- * @brief Flattens the morphology data into separate containers.
+ * @brief Flattens the morphology data into separate containers, packing the primitives of consecutive cells in a few
+ * large geometries instead of one geometry per cell.
  */
 template<typename PrimitiveType>
 class DataFlattener
 {
 public:
+    static inline constexpr size_t maxPrimitivesPerGeometry = 1 << 20;
+
     struct FlatData
     {
         std::vector<std::vector<SectionTypeMapping>> sectionTypeMappings;
         std::vector<CellCompartments> compartments;
         std::vector<std::vector<PrimitiveType>> geometries;
+        CellPrimitiveRanges ranges;
+    };
 
-        FlatData(std::size_t size)
-        {
-            sectionTypeMappings.reserve(size);
-            compartments.reserve(size);
-            geometries.reserve(size);
-        }
+    static FlatData flatten(std::vector<NeuronGeometry<PrimitiveType>> &input)
+    {
+        auto flatData = FlatData();
+        flatData.sectionTypeMappings.reserve(input.size());
+        flatData.compartments.reserve(input.size());
+
+        auto &ranges = flatData.ranges;
+        ranges = _buildRanges(input);
+
+        auto &geometryCells = ranges.geometryCells;
+        auto &cellOffsets = ranges.cellOffsets;
+        auto geometryCount = geometryCells.size() - 1;
+        flatData.geometries.resize(geometryCount);
 
-        void flattenElement(NeuronGeometry<PrimitiveType> &element)
+        for (size_t i = 0; i < geometryCount; ++i)
         {
-            sectionTypeMappings.push_back(std::move(element.sectionTypeMapping));
-            compartments.push_back({element.primitives.size(), std::move(element.sectionSegmentMapping)});
-            geometries.push_back(std::move(element.primitives));
+            auto firstCell = geometryCells[i];
+            auto lastCell = geometryCells[i + 1];
+
+            auto &primitives = flatData.geometries[i];
+            primitives.reserve(cellOffsets[lastCell] - cellOffsets[firstCell]);
+
+            for (auto cell = firstCell; cell < lastCell; ++cell)
+            {
+                auto &element = input[cell];
+                auto &cellPrimitives = element.primitives;
+                flatData.sectionTypeMappings.push_back(std::move(element.sectionTypeMapping));
+                flatData.compartments.push_back({cellPrimitives.size(), std::move(element.sectionSegmentMapping)});
+                primitives.insert(primitives.end(), cellPrimitives.begin(), cellPrimitives.end());
+                cellPrimitives = std::vector<PrimitiveType>();
+            }
         }
-    };
 
-    static FlatData flatten(std::vector<NeuronGeometry<PrimitiveType>> &input)
+        return flatData;
+    }
+
+private:
+    static CellPrimitiveRanges _buildRanges(const std::vector<NeuronGeometry<PrimitiveType>> &input)
     {
-        auto flatData = FlatData(input.size());
+        auto cellPrimitiveCounts = std::vector<size_t>();
+        cellPrimitiveCounts.reserve(input.size());
         for (auto &element : input)
         {
-            flatData.flattenElement(element);
+            cellPrimitiveCounts.push_back(element.primitives.size());
         }
-        return flatData;
+        return CellPrimitiveRangesBuilder::build(cellPrimitiveCounts, maxPrimitivesPerGeometry);
     }
 };
 
@@ -259,6 +411,7 @@ public:
         auto builder = ModelBuilder(model);
         builder.addIds(std::move(context.ids));
         builder.addGeometry(std::move(data.geometries));
+        builder.addCellRanges(std::move(data.ranges));
         builder.addNeuronSections(std::move(data.sectionTypeMappings));
         builder.addColoring(std::move(context.colorData));
         builder.addDefaultColor();
@@ -36,7 +36,7 @@ public:
      * @param colors The color source.
      * @param views The geometry to color.
      */
-    virtual void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) const = 0;
+    virtual void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) = 0;
 
     /**
      * @brief Applies the colors of an indexed ColorMap component to the underlying geometry.
@@ -47,5 +47,5 @@ public:
     virtual void colorByColormap(
         const brayns::ColorMap &colors,
         const brayns::Geometries &geometries,
-        brayns::GeometryViews &views) const = 0;
+        brayns::GeometryViews &views) = 0;
 };
@@ -20,7 +20,7 @@
 
 #include "ComposedColorHandler.h"
 
-void ComposedColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) const
+void ComposedColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views)
 {
     auto &colorList = colors.elements;
     auto &viewList = views.elements;
@@ -37,7 +37,7 @@ void ComposedColorHandler::colorByElement(const brayns::ColorList &colors, brayn
 void ComposedColorHandler::colorByColormap(
     const brayns::ColorMap &colorMap,
     const brayns::Geometries &geometries,
-    brayns::GeometryViews &views) const
+    brayns::GeometryViews &views)
 {
     assert(colorMap.colors.size() <= 256);
 
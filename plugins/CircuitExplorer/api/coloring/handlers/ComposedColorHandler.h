@@ -27,10 +27,10 @@
 class ComposedColorHandler final : public IColorHandler
 {
 public:
-    void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) const override;
+    void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) override;
 
     void colorByColormap(
         const brayns::ColorMap &colorMap,
         const brayns::Geometries &geometries,
-        brayns::GeometryViews &views) const override;
+        brayns::GeometryViews &views) override;
 };
@@ -18,7 +18,7 @@
 
 #include "EndfeetColorHandler.h"
 
-void EndfeetColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) const
+void EndfeetColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views)
 {
     auto &colorList = colors.elements;
     auto &viewList = views.elements;
@@ -35,7 +35,7 @@ void EndfeetColorHandler::colorByElement(const brayns::ColorList &colors, brayns
 void EndfeetColorHandler::colorByColormap(
     const brayns::ColorMap &colorMap,
     const brayns::Geometries &geometries,
-    brayns::GeometryViews &views) const
+    brayns::GeometryViews &views)
 {
     (void)colorMap;
     (void)geometries;
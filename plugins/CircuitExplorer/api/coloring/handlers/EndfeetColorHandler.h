@@ -26,10 +26,10 @@
 class EndfeetColorHandler final : public IColorHandler
 {
 public:
-    void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) const override;
+    void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) override;
 
     void colorByColormap(
         const brayns::ColorMap &colorMap,
         const brayns::Geometries &geometries,
-        brayns::GeometryViews &views) const override;
+        brayns::GeometryViews &views) override;
 };
@@ -0,0 +1,185 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "MergedColorHandler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <tuple>
+#include <utility>
+
+namespace
+{
+class ColorPalette
+{
+public:
+    static inline constexpr size_t maxSize = 256;
+
+    /**
+     * @brief Builds the list of distinct colors and the index of the color of each cell in it.
+     *
+     * @return false if there are too many distinct colors to be indexed with 8 bits.
+     */
+    static bool build(
+        const std::vector<brayns::Vector4f> &colors,
+        std::vector<brayns::Vector4f> &palette,
+        std::vector<uint8_t> &indices)
+    {
+        auto colorIndices = std::map<brayns::Vector4f, uint8_t, ColorLess>();
+        palette.clear();
+        indices.resize(colors.size());
+
+        for (size_t i = 0; i < colors.size(); ++i)
+        {
+            auto [it, inserted] = colorIndices.try_emplace(colors[i], static_cast<uint8_t>(palette.size()));
+            if (inserted)
+            {
+                if (palette.size() == maxSize)
+                {
+                    return false;
+                }
+                palette.push_back(colors[i]);
+            }
+            indices[i] = it->second;
+        }
+
+        return true;
+    }
+
+private:
+    struct ColorLess
+    {
+        bool operator()(const brayns::Vector4f &left, const brayns::Vector4f &right) const noexcept
+        {
+            return std::tie(left.x, left.y, left.z, left.w) < std::tie(right.x, right.y, right.z, right.w);
+        }
+    };
+};
+}
+
+MergedColorHandler::MergedColorHandler(CellPrimitiveRanges ranges):
+    _ranges(std::move(ranges))
+{
+}
+
+void MergedColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views)
+{
+    assert(colors.elements.size() + 1 == _ranges.cellOffsets.size());
+
+    auto cellIndices = std::vector<uint8_t>();
+    if (ColorPalette::build(colors.elements, _palette, cellIndices))
+    {
+        _colorByPalette(cellIndices, views);
+    }
+    else
+    {
+        _colorByPrimitive(colors.elements, views);
+    }
+
+    views.modified = true;
+}
+
+void MergedColorHandler::colorByColormap(
+    const brayns::ColorMap &colorMap,
+    const brayns::Geometries &geometries,
+    brayns::GeometryViews &views)
+{
+    assert(colorMap.colors.size() <= 256);
+    assert(colorMap.indices.size() == _ranges.cellOffsets.back());
+
+    auto colorData = ospray::cpp::SharedData(colorMap.colors);
+
+    size_t mappingOffset = 0;
+    for (size_t i = 0; i < views.elements.size(); ++i)
+    {
+        auto numPrimitives = geometries.elements[i].numPrimitives();
+
+        auto geometryMapping = &colorMap.indices[mappingOffset];
+        auto mappingData = ospray::cpp::SharedData(geometryMapping, numPrimitives);
+
+        views.elements[i].setColorMap(mappingData, colorData);
+        mappingOffset += numPrimitives;
+    }
+
+    // The views now share the colormap buffers
+    _primitiveIndices = std::vector<uint8_t>();
+    _primitiveColors = std::vector<brayns::Vector4f>();
+
+    views.modified = true;
+}
+
+void MergedColorHandler::_colorByPalette(const std::vector<uint8_t> &cellIndices, brayns::GeometryViews &views)
+{
+    auto &cellOffsets = _ranges.cellOffsets;
+    auto &geometryCells = _ranges.geometryCells;
+
+    _primitiveIndices.resize(cellOffsets.back());
+
+    auto cellCount = cellIndices.size();
+
+#pragma omp parallel for
+    for (size_t cell = 0; cell < cellCount; ++cell)
+    {
+        auto begin = _primitiveIndices.begin() + static_cast<std::ptrdiff_t>(cellOffsets[cell]);
+        auto end = _primitiveIndices.begin() + static_cast<std::ptrdiff_t>(cellOffsets[cell + 1]);
+        std::fill(begin, end, cellIndices[cell]);
+    }
+
+    auto colorData = ospray::cpp::SharedData(_palette);
+
+    for (size_t i = 0; i < views.elements.size(); ++i)
+    {
+        auto baseOffset = cellOffsets[geometryCells[i]];
+        auto primitiveCount = cellOffsets[geometryCells[i + 1]] - baseOffset;
+        auto indexData = ospray::cpp::SharedData(_primitiveIndices.data() + baseOffset, primitiveCount);
+        views.elements[i].setColorMap(indexData, colorData);
+    }
+
+    _primitiveColors = std::vector<brayns::Vector4f>();
+}
+
+void MergedColorHandler::_colorByPrimitive(const std::vector<brayns::Vector4f> &colors, brayns::GeometryViews &views)
+{
+    auto &cellOffsets = _ranges.cellOffsets;
+    auto &geometryCells = _ranges.geometryCells;
+
+    _primitiveColors.resize(cellOffsets.back());
+
+    auto cellCount = colors.size();
+
+#pragma omp parallel for
+    for (size_t cell = 0; cell < cellCount; ++cell)
+    {
+        auto begin = _primitiveColors.begin() + static_cast<std::ptrdiff_t>(cellOffsets[cell]);
+        auto end = _primitiveColors.begin() + static_cast<std::ptrdiff_t>(cellOffsets[cell + 1]);
+        std::fill(begin, end, colors[cell]);
+    }
+
+    for (size_t i = 0; i < views.elements.size(); ++i)
+    {
+        auto baseOffset = cellOffsets[geometryCells[i]];
+        auto primitiveCount = cellOffsets[geometryCells[i + 1]] - baseOffset;
+        auto colorData = ospray::cpp::SharedData(_primitiveColors.data() + baseOffset, primitiveCount);
+        views.elements[i].setColorPerPrimitive(colorData);
+    }
+
+    _primitiveIndices = std::vector<uint8_t>();
+}
@@ -0,0 +1,52 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman <nadir.romanguerrero@epfl.ch>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <api/coloring/IColorHandler.h>
+#include <components/CellPrimitiveRanges.h>
+
+/**
+ * @brief Handles coloring for circuits whose cells are packed in a few merged geometries.
+ *
+ * Per-cell colors are applied as a palette of the distinct colors indexed with one byte per primitive, which is enough
+ * for most colorings (by id, layer, etype...). Only when there are more than 256 distinct colors, one color per
+ * primitive is stored. The buffers are kept by the handler and shared with the geometry views to avoid any copy.
+ */
+class MergedColorHandler final : public IColorHandler
+{
+public:
+    explicit MergedColorHandler(CellPrimitiveRanges ranges);
+
+    void colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) override;
+
+    void colorByColormap(
+        const brayns::ColorMap &colorMap,
+        const brayns::Geometries &geometries,
+        brayns::GeometryViews &views) override;
+
+private:
+    void _colorByPalette(const std::vector<uint8_t> &cellIndices, brayns::GeometryViews &views);
+    void _colorByPrimitive(const std::vector<brayns::Vector4f> &colors, brayns::GeometryViews &views);
+
+private:
+    CellPrimitiveRanges _ranges;
+    std::vector<brayns::Vector4f> _palette;
+    std::vector<uint8_t> _primitiveIndices;
+    std::vector<brayns::Vector4f> _primitiveColors;
+};
@@ -20,7 +20,7 @@
 
 #include "SimpleColorHandler.h"
 
-void SimpleColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views) const
+void SimpleColorHandler::colorByElement(const brayns::ColorList &colors, brayns::GeometryViews &views)
 {
     auto &view = views.elements.front();
     view.setColorPerPrimitive(ospray::cpp::SharedData(colors.elements));
@@ -30,7 +30,7 @@ void SimpleColorHandler::colorByElement(const brayns::ColorList &colors, brayns:
 void SimpleColorHandler::colorByColormap(
     const brayns::ColorMap &colorMap,
     const brayns::Geometries &geometries,
-    brayns::GeometryViews &views) const
+    brayns::GeometryViews &views)
 {
     (void)geometries;
 
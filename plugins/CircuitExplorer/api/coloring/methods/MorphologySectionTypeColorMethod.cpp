@@ -24,7 +24,7 @@
 #include <brayns/engine/components/Geometries.h>
 #include <brayns/engine/components/GeometryViews.h>
 
-#include <api/coloring/handlers/ComposedColorHandler.h>
+#include <components/CellPrimitiveRanges.h>
 #include <components/ColorHandler.h>
 #include <components/NeuronSectionType.h>
 
@@ -63,9 +63,9 @@ private:
 
         colorMap.colors = _buildColorBuffer(sectionColors);
 
-        auto &geometries = components.get<brayns::Geometries>().elements;
+        auto &cellOffsets = components.get<CellPrimitiveRanges>().cellOffsets;
         auto &sections = components.get<NeuronSectionType>().mappings;
-        colorMap.indices = _buildIndexBuffer(geometries, sections, sectionIndices);
+        colorMap.indices = _buildIndexBuffer(cellOffsets, sections, sectionIndices);
 
         return colorMap;
     }
@@ -105,16 +105,16 @@ private:
     }
 
     static std::vector<uint8_t> _buildIndexBuffer(
-        const std::vector<brayns::Geometry> &geometries,
+        const std::vector<size_t> &cellOffsets,
         const std::vector<std::vector<SectionTypeMapping>> &sections,
         const std::vector<IndexedSection> &sectionIndices)
     {
-        auto indices = std::vector<uint8_t>(_countPrimitives(geometries));
+        auto indices = std::vector<uint8_t>(cellOffsets.back());
 
-        auto elementIndexBegin = 0ul;
-
-        for (size_t i = 0; i < geometries.size(); ++i)
+        for (size_t i = 0; i < sections.size(); ++i)
         {
+            auto elementIndexBegin = cellOffsets[i];
+
             for (auto &entry : sectionIndices)
             {
                 const auto *mapping = _getMappingForSection(entry.section, sections[i]);
@@ -128,25 +128,11 @@ private:
                 auto end = indices.begin() + elementIndexBegin + mapping->end;
                 std::fill(start, end, entry.index);
             }
-
-            elementIndexBegin += geometries[i].numPrimitives();
         }
 
         return indices;
     }
 
-    static size_t _countPrimitives(const std::vector<brayns::Geometry> &geometries)
-    {
-        auto totalPrimitives = 0ul;
-
-        for (auto &geometry : geometries)
-        {
-            totalPrimitives += geometry.numPrimitives();
-        }
-
-        return totalPrimitives;
-    }
-
     static const SectionTypeMapping *_getMappingForSection(
         NeuronSection section,
         const std::vector<SectionTypeMapping> &mapping)
@@ -32,11 +32,15 @@ public:
     virtual ~IColormapIndexer() = default;
 
     /**
-     * @brief Updates the indices in the indices buffer
+     * @brief Updates the indices in the indices buffer. The buffer is only resized if its size does not match the
+     * number of indexed elements, so that it can be updated in place from one frame to the next.
      *
      * @param data
      * @param range
      * @param indices
      */
-    virtual std::vector<uint8_t> generate(const std::vector<float> &data, const brayns::Vector2f &range) noexcept = 0;
+    virtual void generate(
+        const std::vector<float> &data,
+        const brayns::Vector2f &range,
+        std::vector<uint8_t> &indices) noexcept = 0;
 };
@@ -64,4 +64,16 @@ public:
      * @return std::vector<float>
      */
     virtual std::vector<float> getFrame(double timestamp) const = 0;
+
+    /**
+     * @brief Reads a frame from the report into a caller owned buffer, resized to the frame size, so the caller can
+     * reuse its storage across frames
+     *
+     * @param timestamp Timestamp of the frame to load
+     * @param buffer Frame destination
+     */
+    virtual void getFrame(double timestamp, std::vector<float> &buffer) const
+    {
+        buffer = getFrame(timestamp);
+    }
 };
@@ -0,0 +1,247 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "PrefetchReportData.h"
+#include "ReportFrames.h"
+#include "ReportReadLock.h"
+
+#include <brayns/utils/Log.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+PrefetchReportData::PrefetchReportData(std::unique_ptr<IReportData> data, size_t memoryBudget, size_t readAhead):
+    _data(std::move(data)),
+    _memoryBudget(memoryBudget),
+    _readAhead(readAhead),
+    _frameCount(ReportFrames::count(*_data))
+{
+    if (_memoryBudget == 0)
+    {
+        throw std::invalid_argument("Report frame cache budget cannot be zero");
+    }
+    if (_readAhead > 0)
+    {
+        _thread = std::thread([this] { _run(); });
+    }
+}
+
+PrefetchReportData::~PrefetchReportData()
+{
+    {
+        auto lock = std::lock_guard(_mutex);
+        _running = false;
+        _queue.clear();
+    }
+    _condition.notify_all();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+double PrefetchReportData::getStartTime() const noexcept
+{
+    return _data->getStartTime();
+}
+
+double PrefetchReportData::getEndTime() const noexcept
+{
+    return _data->getEndTime();
+}
+
+double PrefetchReportData::getTimeStep() const noexcept
+{
+    return _data->getTimeStep();
+}
+
+std::string PrefetchReportData::getTimeUnit() const noexcept
+{
+    return _data->getTimeUnit();
+}
+
+std::vector<float> PrefetchReportData::getFrame(double timestamp) const
+{
+    auto buffer = std::vector<float>();
+    getFrame(timestamp, buffer);
+    return buffer;
+}
+
+void PrefetchReportData::getFrame(double timestamp, std::vector<float> &buffer) const
+{
+    auto index = ReportFrames::toIndex(*_data, timestamp);
+
+    {
+        auto lock = std::lock_guard(_mutex);
+        _schedule(index);
+
+        auto it = _frames.find(index);
+        if (it != _frames.end())
+        {
+            ++_statistics.hits;
+            auto &frame = it->second;
+            _usage.splice(_usage.begin(), _usage, frame.usage);
+            buffer.assign(frame.data.begin(), frame.data.end());
+            return;
+        }
+
+        ++_statistics.misses;
+    }
+
+    auto data = _read(index, timestamp);
+    buffer.assign(data.begin(), data.end());
+    _store(index, std::move(data));
+}
+
+PrefetchStatistics PrefetchReportData::getStatistics() const
+{
+    auto lock = std::lock_guard(_mutex);
+    auto statistics = _statistics;
+    statistics.cachedBytes = _cachedBytes;
+    return statistics;
+}
+
+void PrefetchReportData::_run()
+{
+    auto lock = std::unique_lock(_mutex);
+
+    while (true)
+    {
+        _condition.wait(lock, [this] { return !_running || !_queue.empty(); });
+
+        if (!_running)
+        {
+            break;
+        }
+
+        auto index = _queue.front();
+        _queue.pop_front();
+
+        if (_frames.contains(index))
+        {
+            continue;
+        }
+
+        lock.unlock();
+
+        try
+        {
+            auto timestamp = ReportFrames::toTimestamp(*_data, index);
+            _store(index, _read(index, timestamp));
+        }
+        catch (const std::exception &e)
+        {
+            brayns::Log::warn("[CE] Failed to prefetch report frame {}: '{}'.", index, e.what());
+        }
+
+        lock.lock();
+    }
+}
+
+std::vector<float> PrefetchReportData::_read(size_t index, double timestamp) const
+{
+    // Taken before the cache lookup so that a frame read by the other thread meanwhile is not read twice, and shared
+    // by all the reports as the decorated ones are not required to be thread safe
+    auto lock = ReportReadLock::acquire();
+
+    {
+        auto cacheLock = std::lock_guard(_mutex);
+        auto it = _frames.find(index);
+        if (it != _frames.end())
+        {
+            return it->second.data;
+        }
+    }
+
+    return _data->getFrame(timestamp);
+}
+
+void PrefetchReportData::_store(size_t index, std::vector<float> data) const
+{
+    auto lock = std::lock_guard(_mutex);
+
+    auto bytes = data.size() * sizeof(float);
+    _frameBytes = bytes;
+
+    if (bytes > _memoryBudget)
+    {
+        // Frames cannot be cached so prefetching them would only read them twice
+        _queue.clear();
+        return;
+    }
+
+    if (_frames.contains(index))
+    {
+        return;
+    }
+
+    while (_cachedBytes + bytes > _memoryBudget)
+    {
+        auto evicted = _frames.find(_usage.back());
+        _cachedBytes -= evicted->second.data.size() * sizeof(float);
+        _frames.erase(evicted);
+        _usage.pop_back();
+    }
+
+    _usage.push_front(index);
+    _frames.emplace(index, CachedFrame{std::move(data), _usage.begin()});
+    _cachedBytes += bytes;
+}
+
+void PrefetchReportData::_schedule(size_t index) const
+{
+    if (_readAhead == 0)
+    {
+        return;
+    }
+
+    if (index != _lastIndex)
+    {
+        _backward = index < _lastIndex;
+        _lastIndex = index;
+    }
+
+    // Prefetch only once the frame size is known, keeping the requested frame in the cache beside the next ones
+    auto readAhead = size_t(0);
+    if (_frameBytes > 0)
+    {
+        auto capacity = _memoryBudget / _frameBytes;
+        readAhead = std::min(_readAhead, capacity > 0 ? capacity - 1 : 0);
+    }
+
+    _queue.clear();
+
+    for (size_t i = 1; i <= readAhead; ++i)
+    {
+        if (_backward ? i > index : index + i >= _frameCount)
+        {
+            break;
+        }
+
+        auto next = _backward ? index - i : index + i;
+        if (!_frames.contains(next))
+        {
+            _queue.push_back(next);
+        }
+    }
+
+    _condition.notify_one();
+}
@@ -0,0 +1,113 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "IReportData.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * @brief Cache usage counters of a PrefetchReportData.
+ */
+struct PrefetchStatistics
+{
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t cachedBytes = 0;
+};
+
+/**
+ * @brief IReportData decorator that keeps the recently used frames in a memory bounded LRU cache and reads ahead, on a
+ * background thread, the frames following the last requested one in the current playback direction. The thread is
+ * only started when read-ahead is enabled.
+ */
+class PrefetchReportData : public IReportData
+{
+public:
+    /**
+     * @brief Wraps the given report data.
+     *
+     * @param data Decorated report data.
+     * @param memoryBudget Maximum size in bytes of the cached frames.
+     * @param readAhead Maximum number of frames to prefetch after each request, 0 to disable read-ahead.
+     * @throws std::invalid_argument if memoryBudget is zero.
+     */
+    PrefetchReportData(std::unique_ptr<IReportData> data, size_t memoryBudget, size_t readAhead);
+    ~PrefetchReportData();
+
+    PrefetchReportData(const PrefetchReportData &) = delete;
+    PrefetchReportData &operator=(const PrefetchReportData &) = delete;
+
+    PrefetchReportData(PrefetchReportData &&) = delete;
+    PrefetchReportData &operator=(PrefetchReportData &&) = delete;
+
+    double getStartTime() const noexcept override;
+    double getEndTime() const noexcept override;
+    double getTimeStep() const noexcept override;
+    std::string getTimeUnit() const noexcept override;
+    std::vector<float> getFrame(double timestamp) const override;
+    void getFrame(double timestamp, std::vector<float> &buffer) const override;
+
+    /**
+     * @brief Returns the number of frames served from the cache and read on demand, and the size of the cache.
+     *
+     * @return PrefetchStatistics
+     */
+    PrefetchStatistics getStatistics() const;
+
+private:
+    struct CachedFrame
+    {
+        std::vector<float> data;
+        std::list<size_t>::iterator usage;
+    };
+
+    void _run();
+    std::vector<float> _read(size_t index, double timestamp) const;
+    void _store(size_t index, std::vector<float> data) const;
+    void _schedule(size_t index) const;
+
+private:
+    std::unique_ptr<IReportData> _data;
+    size_t _memoryBudget;
+    size_t _readAhead;
+    size_t _frameCount;
+
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _condition;
+    mutable std::unordered_map<size_t, CachedFrame> _frames;
+    mutable std::list<size_t> _usage;
+    mutable std::deque<size_t> _queue;
+    mutable size_t _cachedBytes = 0;
+    mutable size_t _lastIndex = 0;
+    mutable bool _backward = false;
+    mutable size_t _frameBytes = 0;
+    mutable PrefetchStatistics _statistics;
+    bool _running = true;
+    std::thread _thread;
+};
@@ -0,0 +1,385 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "PreloadedReportData.h"
+#include "ReportFrames.h"
+
+#include <brayns/utils/Quantizer.h>
+#include <brayns/utils/ThreadPool.h>
+
+#include <cmath>
+#include <future>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+class Codec
+{
+public:
+    static inline constexpr size_t keyFrameInterval = 32;
+    static inline constexpr int8_t deltaEscape = -128;
+    static inline constexpr float keyRangeMargin = 0.25f;
+
+    explicit Codec(const brayns::Vector2f &range):
+        _start(range.x),
+        _end(range.y)
+    {
+        auto extent = std::fabs(_end - _start);
+        _invExtent = extent > 0.f ? 1.f / extent : 0.f;
+        _step8 = extent / 255.f;
+        _step16 = extent / 65535.f;
+    }
+
+    uint16_t encode16(float value) const noexcept
+    {
+        value = value > _end ? _end : (value < _start ? _start : value);
+        auto normalized = (value - _start) * _invExtent;
+        return static_cast<uint16_t>(std::lround(normalized * 65535.f));
+    }
+
+    float decode8(uint8_t code) const noexcept
+    {
+        // Values are truncated to their bin, so the center of the bin halves the error, except for the top code that
+        // only holds the maximum of the range
+        if (code == 255)
+        {
+            return _end;
+        }
+        return _start + (static_cast<float>(code) + 0.5f) * _step8;
+    }
+
+    float decode16(uint16_t code) const noexcept
+    {
+        return _start + static_cast<float>(code) * _step16;
+    }
+
+private:
+    float _start;
+    float _end;
+    float _invExtent;
+    float _step8;
+    float _step16;
+};
+
+class ValueRange
+{
+public:
+    static brayns::Vector2f compute(const std::vector<float> &values)
+    {
+        auto minValue = std::numeric_limits<float>::max();
+        auto maxValue = std::numeric_limits<float>::lowest();
+
+#pragma omp parallel for reduction(min : minValue) reduction(max : maxValue)
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            minValue = values[i] < minValue ? values[i] : minValue;
+            maxValue = values[i] > maxValue ? values[i] : maxValue;
+        }
+
+        if (minValue > maxValue)
+        {
+            return brayns::Vector2f(0.f);
+        }
+        return brayns::Vector2f(minValue, maxValue);
+    }
+
+    static brayns::Vector2f widen(const brayns::Vector2f &range, float margin)
+    {
+        auto padding = (range.y - range.x) * margin;
+        return brayns::Vector2f(range.x - padding, range.y + padding);
+    }
+
+    static bool contains(const brayns::Vector2f &range, const brayns::Vector2f &values)
+    {
+        return values.x >= range.x && values.y <= range.y;
+    }
+};
+
+class FrameReader
+{
+public:
+    static std::vector<float> read(const IReportData &source, size_t index, size_t elementCount)
+    {
+        auto timestamp = ReportFrames::toTimestamp(source, index);
+        auto values = source.getFrame(timestamp);
+        if (elementCount != 0 && values.size() != elementCount)
+        {
+            throw std::runtime_error("Cannot preload a report with frames of different sizes");
+        }
+        return values;
+    }
+};
+}
+
+PreloadedReportData::PreloadedReportData(const IReportData &source, ReportPreload mode):
+    _start(source.getStartTime()),
+    _end(source.getEndTime()),
+    _dt(source.getTimeStep()),
+    _timeUnit(source.getTimeUnit()),
+    _mode(mode)
+{
+    if (_mode == ReportPreload::None)
+    {
+        throw std::invalid_argument("Invalid report preload mode");
+    }
+    _ingest(source);
+}
+
+double PreloadedReportData::getStartTime() const noexcept
+{
+    return _start;
+}
+
+double PreloadedReportData::getEndTime() const noexcept
+{
+    return _end;
+}
+
+double PreloadedReportData::getTimeStep() const noexcept
+{
+    return _dt;
+}
+
+std::string PreloadedReportData::getTimeUnit() const noexcept
+{
+    return _timeUnit;
+}
+
+std::vector<float> PreloadedReportData::getFrame(double timestamp) const
+{
+    auto values = std::vector<float>();
+    getFrame(timestamp, values);
+    return values;
+}
+
+void PreloadedReportData::getFrame(double timestamp, std::vector<float> &values) const
+{
+    auto index = ReportFrames::toIndex(*this, timestamp);
+    auto &slot = _frames[index];
+    auto codec = Codec(slot.range);
+    values.resize(_elementCount);
+
+    if (slot.encoding == FrameEncoding::Codes8)
+    {
+        auto codes = _codes8.data() + slot.offset;
+
+#pragma omp parallel for
+        for (size_t i = 0; i < _elementCount; ++i)
+        {
+            values[i] = codec.decode8(codes[i]);
+        }
+        return;
+    }
+
+    auto lock = std::unique_lock(_mutex, std::defer_lock);
+    auto codes = _codes16.data() + slot.offset;
+
+    if (slot.encoding == FrameEncoding::Delta8)
+    {
+        lock.lock();
+        codes = _decodeCodes(index).data();
+    }
+
+#pragma omp parallel for
+    for (size_t i = 0; i < _elementCount; ++i)
+    {
+        values[i] = codec.decode16(codes[i]);
+    }
+}
+
+size_t PreloadedReportData::getMemorySize() const noexcept
+{
+    auto codesSize = _codes8.size() + _codes16.size() * sizeof(uint16_t) + _deltas.size();
+    auto exceptionsSize = _exceptions.size() * sizeof(DeltaException);
+    return codesSize + exceptionsSize + _frames.size() * sizeof(FrameSlot);
+}
+
+void PreloadedReportData::_ingest(const IReportData &source)
+{
+    auto frameCount = ReportFrames::count(source);
+    _frames.reserve(frameCount);
+
+    auto values = FrameReader::read(source, 0, 0);
+    _elementCount = values.size();
+
+    auto poolSize = frameCount * _elementCount;
+    if (_mode == ReportPreload::Quantized8)
+    {
+        _codes8.reserve(poolSize);
+    }
+    if (_mode == ReportPreload::Quantized16)
+    {
+        _codes16.reserve(poolSize);
+    }
+    if (_mode == ReportPreload::Quantized16Delta)
+    {
+        _codes16.reserve((frameCount / Codec::keyFrameInterval + 1) * _elementCount);
+        _deltas.reserve(poolSize);
+    }
+
+    auto previous = KeyFrame();
+    auto &pool = brayns::ThreadPool::getDefault();
+
+    for (size_t i = 0; i < frameCount; ++i)
+    {
+        // Read the next frame while the current one is quantized
+        auto next = std::future<std::vector<float>>();
+        if (i + 1 < frameCount)
+        {
+            next = pool.submit([&source, index = i + 1, count = _elementCount]
+                               { return FrameReader::read(source, index, count); });
+        }
+
+        try
+        {
+            _append(values, previous, i);
+        }
+        catch (...)
+        {
+            // The pending read references the source, which may not outlive the exception
+            if (next.valid())
+            {
+                next.wait();
+            }
+            throw;
+        }
+
+        if (next.valid())
+        {
+            values = next.get();
+        }
+    }
+}
+
+void PreloadedReportData::_append(const std::vector<float> &values, KeyFrame &previous, size_t index)
+{
+    auto range = ValueRange::compute(values);
+
+    if (_mode == ReportPreload::Quantized8)
+    {
+        auto codes = std::vector<uint8_t>();
+        brayns::Quantizer::quantize(values, range, codes);
+        _frames.push_back({FrameEncoding::Codes8, range, _codes8.size()});
+        _codes8.insert(_codes8.end(), codes.begin(), codes.end());
+        return;
+    }
+
+    // Deltas are only meaningful between codes of the same range, so a frame leaving the range of its key frame
+    // becomes a key frame itself
+    auto isDelta = _mode == ReportPreload::Quantized16Delta && index % Codec::keyFrameInterval != 0
+        && ValueRange::contains(previous.range, range);
+
+    if (_mode == ReportPreload::Quantized16Delta && !isDelta)
+    {
+        range = ValueRange::widen(range, Codec::keyRangeMargin);
+    }
+    if (isDelta)
+    {
+        range = previous.range;
+    }
+
+    auto codec = Codec(range);
+    auto codes = std::vector<uint16_t>(_elementCount);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < _elementCount; ++i)
+    {
+        codes[i] = codec.encode16(values[i]);
+    }
+
+    if (isDelta)
+    {
+        auto deltas = std::vector<int8_t>(_elementCount);
+
+#pragma omp parallel for
+        for (size_t i = 0; i < _elementCount; ++i)
+        {
+            auto delta = static_cast<int32_t>(codes[i]) - static_cast<int32_t>(previous.codes[i]);
+            auto fits = delta > Codec::deltaEscape && delta <= 127;
+            deltas[i] = fits ? static_cast<int8_t>(delta) : Codec::deltaEscape;
+        }
+
+        auto exceptionOffset = _exceptions.size();
+        for (size_t i = 0; i < _elementCount; ++i)
+        {
+            if (deltas[i] == Codec::deltaEscape)
+            {
+                _exceptions.push_back({static_cast<uint32_t>(i), codes[i]});
+            }
+        }
+        auto exceptionCount = _exceptions.size() - exceptionOffset;
+
+        // Store a key frame instead when too many values changed a lot
+        if (exceptionCount <= _elementCount / 4)
+        {
+            _frames.push_back({FrameEncoding::Delta8, range, _deltas.size(), exceptionOffset, exceptionCount});
+            _deltas.insert(_deltas.end(), deltas.begin(), deltas.end());
+            previous.codes = std::move(codes);
+            return;
+        }
+
+        _exceptions.resize(exceptionOffset);
+    }
+
+    _frames.push_back({FrameEncoding::Codes16, range, _codes16.size()});
+    _codes16.insert(_codes16.end(), codes.begin(), codes.end());
+    previous.codes = std::move(codes);
+    previous.range = range;
+}
+
+const std::vector<uint16_t> &PreloadedReportData::_decodeCodes(size_t index) const
+{
+    auto keyIndex = index;
+    while (_frames[keyIndex].encoding == FrameEncoding::Delta8)
+    {
+        --keyIndex;
+    }
+
+    if (!_hasDecoded || _decodedIndex < keyIndex || _decodedIndex > index)
+    {
+        auto key = _codes16.begin() + static_cast<std::ptrdiff_t>(_frames[keyIndex].offset);
+        _decodedCodes.assign(key, key + static_cast<std::ptrdiff_t>(_elementCount));
+        _decodedIndex = keyIndex;
+        _hasDecoded = true;
+    }
+
+    for (auto i = _decodedIndex + 1; i <= index; ++i)
+    {
+        auto &slot = _frames[i];
+        auto deltas = _deltas.data() + slot.offset;
+
+#pragma omp parallel for
+        for (size_t j = 0; j < _elementCount; ++j)
+        {
+            auto delta = deltas[j] == Codec::deltaEscape ? 0 : deltas[j];
+            _decodedCodes[j] = static_cast<uint16_t>(_decodedCodes[j] + delta);
+        }
+
+        auto exceptions = _exceptions.data() + slot.exceptionOffset;
+        for (size_t j = 0; j < slot.exceptionCount; ++j)
+        {
+            _decodedCodes[exceptions[j].element] = exceptions[j].code;
+        }
+    }
+
+    _decodedIndex = index;
+    return _decodedCodes;
+}
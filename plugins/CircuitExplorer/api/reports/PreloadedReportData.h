@@ -0,0 +1,115 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "IReportData.h"
+#include "ReportPreload.h"
+
+#include <brayns/utils/MathTypes.h>
+
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @brief In memory IReportData, all the frames of a report are read once and stored quantized to 8 or 16 bits in the
+ * value range of each frame, so that no value is clamped whatever the report type.
+ */
+class PreloadedReportData : public IReportData
+{
+public:
+    /**
+     * @brief Reads and quantizes all the frames of the source report.
+     *
+     * @param source Report to preload.
+     * @param mode Quantization mode, must not be ReportPreload::None.
+     * @throws std::invalid_argument if mode is ReportPreload::None.
+     * @throws std::runtime_error if the report frames have different sizes.
+     */
+    PreloadedReportData(const IReportData &source, ReportPreload mode);
+
+    double getStartTime() const noexcept override;
+    double getEndTime() const noexcept override;
+    double getTimeStep() const noexcept override;
+    std::string getTimeUnit() const noexcept override;
+    std::vector<float> getFrame(double timestamp) const override;
+    void getFrame(double timestamp, std::vector<float> &buffer) const override;
+
+    /**
+     * @brief Returns the memory used by the preloaded frames.
+     *
+     * @return size_t Size in bytes.
+     */
+    size_t getMemorySize() const noexcept;
+
+private:
+    enum class FrameEncoding
+    {
+        Codes8,
+        Codes16,
+        Delta8,
+    };
+
+    struct FrameSlot
+    {
+        FrameEncoding encoding;
+        brayns::Vector2f range;
+        size_t offset;
+        size_t exceptionOffset = 0;
+        size_t exceptionCount = 0;
+    };
+
+    // Value of an element whose difference to the previous frame does not fit in 8 bits
+    struct DeltaException
+    {
+        uint32_t element;
+        uint16_t code;
+    };
+
+    // Codes of the previous frame and range of the last key frame, shared by the delta frames that follow it
+    struct KeyFrame
+    {
+        brayns::Vector2f range{0.f};
+        std::vector<uint16_t> codes;
+    };
+
+    void _ingest(const IReportData &source);
+    void _append(const std::vector<float> &values, KeyFrame &previous, size_t index);
+    const std::vector<uint16_t> &_decodeCodes(size_t index) const;
+
+private:
+    double _start;
+    double _end;
+    double _dt;
+    std::string _timeUnit;
+    ReportPreload _mode;
+    size_t _elementCount = 0;
+    std::vector<FrameSlot> _frames;
+    std::vector<uint8_t> _codes8;
+    std::vector<uint16_t> _codes16;
+    std::vector<int8_t> _deltas;
+    std::vector<DeltaException> _exceptions;
+
+    // Last decoded delta frame, so that sequential playback applies a single difference per frame
+    mutable std::mutex _mutex;
+    mutable std::vector<uint16_t> _decodedCodes;
+    mutable size_t _decodedIndex = 0;
+    mutable bool _hasDecoded = false;
+};
@@ -19,8 +19,12 @@
 #include "ReportFactory.h"
 
 #include <brayns/engine/components/SimulationInfo.h>
+#include <brayns/utils/Log.h>
+#include <brayns/utils/Timer.h>
 
 #include "ColorRampUtils.h"
+#include "PrefetchReportData.h"
+#include "PreloadedReportData.h"
 
 #include <systems/ReportSystem.h>
 
@@ -39,12 +43,47 @@ public:
         return simInfo;
     }
 };
+
+class ReportDataWrapper
+{
+public:
+    static std::unique_ptr<IReportData> wrap(
+        std::unique_ptr<IReportData> data,
+        ReportPreload preload,
+        const ReportCache &cache)
+    {
+        if (preload == ReportPreload::None)
+        {
+            return _cache(std::move(data), cache);
+        }
+
+        auto timer = brayns::Timer();
+        auto preloaded = std::make_unique<PreloadedReportData>(*data, preload);
+
+        auto megabytes = preloaded->getMemorySize() >> 20;
+        brayns::Log::info("[CE] Preloaded report in {} MB in {} second(s).", megabytes, timer.seconds());
+
+        return preloaded;
+    }
+
+private:
+    static std::unique_ptr<IReportData> _cache(std::unique_ptr<IReportData> data, const ReportCache &cache)
+    {
+        if (cache.memoryBudget == 0)
+        {
+            return data;
+        }
+        return std::make_unique<PrefetchReportData>(std::move(data), cache.memoryBudget, cache.readAhead);
+    }
+};
 }
 
-void ReportFactory::create(brayns::Model &model, ReportData reportData)
+void ReportFactory::create(brayns::Model &model, ReportData reportData, ReportPreload preload, const ReportCache &cache)
 {
     auto &components = model.getComponents();
 
+    reportData.data = ReportDataWrapper::wrap(std::move(reportData.data), preload, cache);
+
     auto simInfo = SimulationInfoFactory::create(*reportData.data);
     components.add<brayns::SimulationInfo>(std::move(simInfo));
 
@@ -20,10 +20,25 @@
 
 #include <brayns/engine/model/Model.h>
 
+#include <api/reports/ReportCache.h>
+#include <api/reports/ReportPreload.h>
 #include <components/ReportData.h>
 
 class ReportFactory
 {
 public:
-    static void create(brayns::Model &model, ReportData reportData);
+    /**
+     * @brief Adds the report to the model.
+     *
+     * @param model Model to add the report to.
+     * @param reportData Report data and indexer.
+     * @param preload Whether to preload the whole report in memory, quantized in the value range of each frame, or
+     * to read it on demand.
+     * @param cache Frame cache of a report read on demand, ignored if the report is preloaded.
+     */
+    static void create(
+        brayns::Model &model,
+        ReportData reportData,
+        ReportPreload preload = ReportPreload::None,
+        const ReportCache &cache = {});
 };
@@ -0,0 +1,59 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ReportFrames.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+size_t ReportFrames::count(const IReportData &data)
+{
+    auto dt = data.getTimeStep();
+    if (dt <= 0.0)
+    {
+        return 1;
+    }
+    auto count = std::round((data.getEndTime() - data.getStartTime()) / dt);
+    return std::max(static_cast<size_t>(std::max(count, 0.0)), size_t(1));
+}
+
+size_t ReportFrames::toIndex(const IReportData &data, double timestamp)
+{
+    auto dt = data.getTimeStep();
+    if (dt <= 0.0)
+    {
+        return 0;
+    }
+    auto relative = (timestamp - data.getStartTime()) / dt;
+    if (relative <= 0.0)
+    {
+        return 0;
+    }
+    auto index = static_cast<size_t>(std::floor(relative));
+    return std::min(index, count(data) - 1);
+}
+
+double ReportFrames::toTimestamp(const IReportData &data, size_t index)
+{
+    // Same rounding as the simulation frame timestamps to land inside the frame
+    auto upRoundedDt = std::nextafter(data.getTimeStep(), std::numeric_limits<double>::infinity());
+    return data.getStartTime() + static_cast<double>(index) * upRoundedDt;
+}
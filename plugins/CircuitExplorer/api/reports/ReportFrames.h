@@ -0,0 +1,47 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "IReportData.h"
+
+#include <cstddef>
+
+/**
+ * @brief Conversions between report timestamps and frame indices.
+ */
+class ReportFrames
+{
+public:
+    /**
+     * @brief Returns the number of frames of the report, at least one.
+     */
+    static size_t count(const IReportData &data);
+
+    /**
+     * @brief Returns the index of the frame containing the given timestamp, clamped to the report frames.
+     */
+    static size_t toIndex(const IReportData &data, double timestamp);
+
+    /**
+     * @brief Returns a timestamp that the report resolves to the given frame index.
+     */
+    static double toTimestamp(const IReportData &data, size_t index);
+};
@@ -0,0 +1,36 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <mutex>
+
+/**
+ * @brief Process wide lock serializing the report file reads.
+ *
+ * libsonata and brion read the reports with HDF5, which is not thread safe in standard builds, and several populations
+ * are often backed by the same report file. As models are updated in parallel, every read goes through this lock.
+ * The lock is recursive so that report decorators can hold it around the reads of the report they wrap.
+ */
+class ReportReadLock
+{
+public:
+    static std::unique_lock<std::recursive_mutex> acquire();
+};
@@ -0,0 +1,122 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "SpikeStore.h"
+
+#include <limits>
+
+namespace
+{
+/**
+ * @brief Dense id to cell index table, cell ids are expected to be node indices of a population.
+ */
+class DenseIdMapping
+{
+public:
+    static inline constexpr uint32_t invalid = std::numeric_limits<uint32_t>::max();
+
+    explicit DenseIdMapping(const std::vector<uint64_t> &ids)
+    {
+        if (ids.empty())
+        {
+            return;
+        }
+
+        auto maxId = *std::max_element(ids.begin(), ids.end());
+        _indices.resize(maxId + 1, invalid);
+
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            _indices[ids[i]] = static_cast<uint32_t>(i);
+        }
+    }
+
+    uint32_t find(uint64_t id) const noexcept
+    {
+        return id < _indices.size() ? _indices[id] : invalid;
+    }
+
+private:
+    std::vector<uint32_t> _indices;
+};
+
+struct SpikeEntry
+{
+    float time;
+    uint32_t cell;
+};
+
+class SpikeFilter
+{
+public:
+    static std::vector<SpikeEntry> filter(
+        const std::vector<uint64_t> &ids,
+        const std::vector<std::pair<uint64_t, double>> &spikes)
+    {
+        auto mapping = DenseIdMapping(ids);
+
+        auto result = std::vector<SpikeEntry>();
+        result.reserve(spikes.size());
+
+        for (auto &[id, time] : spikes)
+        {
+            auto cell = mapping.find(id);
+            if (cell == DenseIdMapping::invalid)
+            {
+                continue;
+            }
+            result.push_back({static_cast<float>(time), cell});
+        }
+
+        auto byTime = [](auto &left, auto &right) { return left.time < right.time; };
+        if (!std::is_sorted(result.begin(), result.end(), byTime))
+        {
+            std::stable_sort(result.begin(), result.end(), byTime);
+        }
+
+        return result;
+    }
+};
+}
+
+SpikeStore::SpikeStore(const std::vector<uint64_t> &ids, const std::vector<std::pair<uint64_t, double>> &spikes):
+    _cellCount(ids.size())
+{
+    auto entries = SpikeFilter::filter(ids, spikes);
+
+    _times.reserve(entries.size());
+    _cells.reserve(entries.size());
+
+    for (auto &entry : entries)
+    {
+        _times.push_back(entry.time);
+        _cells.push_back(entry.cell);
+    }
+}
+
+size_t SpikeStore::getCellCount() const noexcept
+{
+    return _cellCount;
+}
+
+size_t SpikeStore::getSpikeCount() const noexcept
+{
+    return _times.size();
+}
@@ -0,0 +1,86 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Time sorted, struct-of-arrays store of the spikes of a selection of cells, to query time windows with a
+ * binary search instead of reading the spike report at every frame.
+ */
+class SpikeStore
+{
+public:
+    /**
+     * @brief Builds the store, discarding the spikes of the cells that are not part of the selection.
+     *
+     * @param ids Selected cell ids, the position of each id is used as the cell index.
+     * @param spikes Report spikes as (cell id, time) pairs, in any order.
+     */
+    SpikeStore(const std::vector<uint64_t> &ids, const std::vector<std::pair<uint64_t, double>> &spikes);
+
+    /**
+     * @brief Returns the number of selected cells.
+     *
+     * @return size_t
+     */
+    size_t getCellCount() const noexcept;
+
+    /**
+     * @brief Returns the number of stored spikes.
+     *
+     * @return size_t
+     */
+    size_t getSpikeCount() const noexcept;
+
+    /**
+     * @brief Calls the callback with the cell index and the time of every spike in [start, end], in time order.
+     *
+     * @tparam Callback void(size_t cellIndex, float time)
+     * @param start Window start time.
+     * @param end Window end time.
+     * @param callback Spike callback.
+     */
+    template<typename Callback>
+    void forEach(float start, float end, Callback &&callback) const
+    {
+        auto first = std::lower_bound(_times.begin(), _times.end(), start);
+        auto last = std::upper_bound(first, _times.end(), end);
+
+        auto begin = static_cast<size_t>(std::distance(_times.begin(), first));
+        auto count = static_cast<size_t>(std::distance(first, last));
+
+        for (size_t i = begin; i < begin + count; ++i)
+        {
+            callback(static_cast<size_t>(_cells[i]), _times[i]);
+        }
+    }
+
+private:
+    size_t _cellCount;
+    std::vector<float> _times;
+    std::vector<uint32_t> _cells;
+};
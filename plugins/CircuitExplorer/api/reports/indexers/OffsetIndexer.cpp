@@ -18,6 +18,8 @@
 
 #include "OffsetIndexer.h"
 
+#include <brayns/utils/Quantizer.h>
+
 namespace
 {
 class OffsetGenerator
@@ -111,24 +113,10 @@ OffsetIndexer::OffsetIndexer(
 {
 }
 
-std::vector<uint8_t> OffsetIndexer::generate(const std::vector<float> &data, const brayns::Vector2f &range) noexcept
+void OffsetIndexer::generate(
+    const std::vector<float> &data,
+    const brayns::Vector2f &range,
+    std::vector<uint8_t> &indices) noexcept
 {
-    std::vector<uint8_t> indices(_offsets.size());
-
-    auto rangeStart = range.x;
-    auto rangeEnd = range.y;
-    auto invFactor = 1.f / std::fabs(rangeEnd - rangeStart);
-
-#pragma omp parallel for
-    for (size_t i = 0; i < _offsets.size(); ++i)
-    {
-        auto offset = _offsets[i];
-        auto value = data[offset];
-        value = value > rangeEnd ? rangeEnd : (value < rangeStart ? rangeStart : value);
-
-        auto normIndex = (value - rangeStart) * invFactor;
-        indices[i] = static_cast<uint8_t>(normIndex * 255.f);
-    }
-
-    return indices;
+    brayns::Quantizer::gatherQuantize(data, _offsets, range, indices);
 }
@@ -29,7 +29,8 @@ public:
     explicit OffsetIndexer(std::vector<size_t> offsets);
     OffsetIndexer(const std::vector<CellCompartments> &structure, const std::vector<CellReportMapping> &mapping);
 
-    std::vector<uint8_t> generate(const std::vector<float> &data, const brayns::Vector2f &range) noexcept override;
+    void generate(const std::vector<float> &data, const brayns::Vector2f &range, std::vector<uint8_t> &indices) noexcept
+        override;
 
 private:
     const std::vector<size_t> _offsets;
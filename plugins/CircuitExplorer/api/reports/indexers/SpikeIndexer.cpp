@@ -18,52 +18,57 @@
 
 #include "SpikeIndexer.h"
 
-#include <numeric>
+#include <brayns/utils/Quantizer.h>
+
+#include <algorithm>
 
 namespace
 {
-class CellSubElementCount
+class CellOffsets
 {
 public:
     static std::vector<size_t> fromCellComparments(const std::vector<CellCompartments> &cellCompartments)
     {
-        std::vector<size_t> cellSubElements;
-        cellSubElements.reserve(cellCompartments.size());
+        std::vector<size_t> cellOffsets;
+        cellOffsets.reserve(cellCompartments.size() + 1);
+
+        size_t offset = 0;
         for (auto &comparment : cellCompartments)
         {
-            cellSubElements.push_back(comparment.numItems);
+            cellOffsets.push_back(offset);
+            offset += comparment.numItems;
         }
-        return cellSubElements;
+        cellOffsets.push_back(offset);
+
+        return cellOffsets;
     }
 };
 }
 
 SpikeIndexer::SpikeIndexer(const std::vector<CellCompartments> &cellCompartments):
-    _cellSubElements(CellSubElementCount::fromCellComparments(cellCompartments)),
-    _totalElements(std::accumulate(_cellSubElements.begin(), _cellSubElements.end(), 0))
+    _cellOffsets(CellOffsets::fromCellComparments(cellCompartments))
 {
 }
 
-std::vector<uint8_t> SpikeIndexer::generate(const std::vector<float> &data, const brayns::Vector2f &range) noexcept
+void SpikeIndexer::generate(
+    const std::vector<float> &data,
+    const brayns::Vector2f &range,
+    std::vector<uint8_t> &indices) noexcept
 {
     // Spike values are hardcoed in range 0 - 1
     (void)range;
 
-    std::vector<uint8_t> indices(_totalElements, 0);
-    size_t writeIndex = 0;
-    for (size_t i = 0; i < data.size(); ++i)
-    {
-        auto value = data[i];
-        auto index = static_cast<uint8_t>(value * 255);
+    brayns::Quantizer::quantize(data, brayns::Vector2f(0.f, 1.f), _cellIndices);
 
-        auto writeCount = _cellSubElements[i];
-        auto begin = indices.begin();
-        std::advance(begin, writeIndex);
-        auto end = indices.begin();
-        std::advance(end, writeIndex + writeCount);
-        std::fill(begin, end, index);
-        writeIndex += writeCount;
-    }
+    indices.resize(_cellOffsets.back());
+
+    auto cellCount = std::min(_cellOffsets.size() - 1, _cellIndices.size());
 
-    return indices;
+#pragma omp parallel for schedule(dynamic, 256)
+    for (size_t i = 0; i < cellCount; ++i)
+    {
+        auto begin = indices.begin() + static_cast<std::ptrdiff_t>(_cellOffsets[i]);
+        auto end = indices.begin() + static_cast<std::ptrdiff_t>(_cellOffsets[i + 1]);
+        std::fill(begin, end, _cellIndices[i]);
+    }
 }
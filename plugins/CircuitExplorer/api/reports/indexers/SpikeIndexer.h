@@ -24,10 +24,11 @@ class SpikeIndexer : public IColormapIndexer
 public:
     explicit SpikeIndexer(const std::vector<CellCompartments> &cellCompartments);
 
-    std::vector<uint8_t> generate(const std::vector<float> &data, const brayns::Vector2f &range) noexcept override;
+    void generate(const std::vector<float> &data, const brayns::Vector2f &range, std::vector<uint8_t> &indices) noexcept
+        override;
 
 private:
-    // How many items to map for each cell
-    std::vector<size_t> _cellSubElements;
-    size_t _totalElements;
+    // Offset of the first item to map for each cell, followed by the total number of items
+    std::vector<size_t> _cellOffsets;
+    std::vector<uint8_t> _cellIndices;
 };
@@ -0,0 +1,36 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Maps the primitives of a circuit whose cells are packed together in a few geometries to the cells they belong
+ * to. Cells are stored contiguously, in the same order as the circuit ids, and never split across geometries.
+ */
+struct CellPrimitiveRanges
+{
+    // Index of the first primitive of each cell in the concatenation of all geometries, plus the total primitive count.
+    std::vector<size_t> cellOffsets;
+    // Index of the first cell of each geometry, plus the total cell count.
+    std::vector<size_t> geometryCells;
+};
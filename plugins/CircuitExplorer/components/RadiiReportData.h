@@ -31,4 +31,6 @@ struct RadiiReportData
     std::vector<size_t> offsets;
     std::vector<float> originalRadii;
     bool lastEnabledFlag = false;
+    // Reused across frames to avoid reallocating a report frame on each update
+    std::vector<float> frame;
 };
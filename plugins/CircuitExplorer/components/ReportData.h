@@ -23,11 +23,30 @@
 #include <api/reports/IColormapIndexer.h>
 #include <api/reports/IReportData.h>
 
+#include <brayns/utils/MathTypes.h>
+
 #include <memory>
+#include <vector>
+
+/**
+ * @brief Storage of the colormap buffers bound to the geometry views by the report, and of the color version of each
+ * view once bound, used to detect reallocations and views colored by something else since.
+ */
+struct ColormapBinding
+{
+    const uint8_t *indices = nullptr;
+    size_t indexCount = 0;
+    const brayns::Vector4f *colors = nullptr;
+    size_t colorCount = 0;
+    std::vector<size_t> viewVersions;
+};
 
 struct ReportData
 {
     std::unique_ptr<IReportData> data;
     std::unique_ptr<IColormapIndexer> indexer;
     bool lastEnabledFlag = false;
+    ColormapBinding binding;
+    // Reused across frames to avoid reallocating a report frame on each update
+    std::vector<float> frame;
 };
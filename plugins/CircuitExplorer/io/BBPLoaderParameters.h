@@ -23,6 +23,7 @@
 #include <brayns/json/Json.h>
 
 #include <io/NeuronMorphologyLoaderParameters.h>
+#include <io/ReportPreloadParameters.h>
 #include <io/bbploader/reports/ReportType.h>
 
 #include <optional>
@@ -35,6 +36,9 @@ struct BBPLoaderParameters
     bbploader::ReportType report_type = bbploader::ReportType::None;
     std::string report_name;
     float spike_transition_time = 0;
+    ReportPreload report_preload = ReportPreload::None;
+    uint32_t report_lookahead = 1;
+    uint32_t report_cache_size = 512;
     NeuronMorphologyLoaderParameters neuron_morphology_parameters;
     bool load_afferent_synapses = false;
     bool load_efferent_synapses = false;
@@ -110,6 +114,27 @@ struct JsonAdapter<BBPLoaderParameters> : ObjectAdapter<BBPLoaderParameters>
             .description("For spike reports, fade-in/out time [ms] from resting to spike state")
             .minimum(0)
             .defaultValue(1);
+        builder
+            .getset(
+                "report_preload",
+                [](auto &object) { return object.report_preload; },
+                [](auto &object, auto value) { object.report_preload = value; })
+            .description("Preload compartment report frames in memory, quantized in the value range of each frame")
+            .defaultValue(ReportPreload::None);
+        builder
+            .getset(
+                "report_lookahead",
+                [](auto &object) { return object.report_lookahead; },
+                [](auto &object, auto value) { object.report_lookahead = value; })
+            .description("Number of compartment report frames loaded in background ahead of the current one")
+            .defaultValue(1);
+        builder
+            .getset(
+                "report_cache_size",
+                [](auto &object) { return object.report_cache_size; },
+                [](auto &object, auto value) { object.report_cache_size = value; })
+            .description("Size [MB] of the recently used report frames cached when not preloaded, 0 to disable")
+            .defaultValue(512);
         builder
             .getset(
                 "neuron_morphology_parameters",
@@ -37,6 +37,7 @@
 #include <api/neuron/NeuronMorphologyReader.h>
 #include <api/neuron/builders/NeuronCapsuleBuilder.h>
 #include <api/neuron/builders/NeuronSphereBuilder.h>
+#include <components/CellPrimitiveRanges.h>
 #include <components/ColorHandler.h>
 #include <components/NeuronSectionGeometryMap.h>
 #include <components/NeuronSectionType.h>
@@ -66,6 +67,7 @@ public:
         std::vector<SectionSegmentMapping> sectionGeometryMapping)
     {
         _components.add<NeuronSectionType>(std::move(sectionTypeMapping));
+        _components.add<CellPrimitiveRanges>(_singleCellRanges());
         _components.add<NeuronSectionGeometryMap>(std::move(sectionGeometryMapping));
     }
 
@@ -80,6 +82,14 @@ public:
         _systems.setColorSystem<brayns::GenericColorSystem>(std::move(methods));
     }
 
+private:
+    CellPrimitiveRanges _singleCellRanges()
+    {
+        auto &geometries = _components.get<brayns::Geometries>();
+        auto primitiveCount = geometries.elements.front().numPrimitives();
+        return {{0, primitiveCount}, {0, 1}};
+    }
+
 private:
     brayns::Components &_components;
     brayns::Systems &_systems;
@@ -23,6 +23,7 @@
 #include <brayns/json/Json.h>
 
 #include <io/NeuronMorphologyLoaderParameters.h>
+#include <io/ReportPreloadParameters.h>
 #include <io/sonataloader/reports/ReportType.h>
 
 struct VasculatureGeometrySettings
@@ -49,6 +50,9 @@ struct SonataNodePopulationParameters
     sonataloader::ReportType report_type = sonataloader::ReportType::None;
     std::string report_name;
     float spike_transition_time = 0;
+    ReportPreload report_preload = ReportPreload::None;
+    uint32_t report_cache_size = 512;
+    uint32_t report_read_ahead = 8;
     std::vector<SonataEdgePopulationParameters> edge_populations;
     NeuronMorphologyLoaderParameters neuron_morphology_parameters;
     VasculatureGeometrySettings vasculature_geometry_parameters;
@@ -211,6 +215,27 @@ struct JsonAdapter<SonataNodePopulationParameters> : ObjectAdapter<SonataNodePop
             .description("When loading a spike report, fade-in/out time [ms], from resting to spike state.")
             .minimum(0)
             .defaultValue(1);
+        builder
+            .getset(
+                "report_preload",
+                [](auto &object) { return object.report_preload; },
+                [](auto &object, auto value) { object.report_preload = value; })
+            .description("Preload compartment report frames in memory, quantized in the value range of each frame")
+            .defaultValue(ReportPreload::None);
+        builder
+            .getset(
+                "report_cache_size",
+                [](auto &object) { return object.report_cache_size; },
+                [](auto &object, auto value) { object.report_cache_size = value; })
+            .description("Size [MB] of the recently used report frames cached when not preloaded, 0 to disable")
+            .defaultValue(512);
+        builder
+            .getset(
+                "report_read_ahead",
+                [](auto &object) { return object.report_read_ahead; },
+                [](auto &object, auto value) { object.report_read_ahead = value; })
+            .description("Number of report frames cached in background ahead of the current one, 0 to disable")
+            .defaultValue(8);
         builder
             .getset(
                 "edge_populations",
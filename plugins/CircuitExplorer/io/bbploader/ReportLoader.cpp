@@ -61,8 +61,9 @@ private:
         auto reportPath = config.getReportSource(reportName).getPath();
         auto uri = brion::URI(reportPath);
         auto report = std::make_unique<brion::CompartmentReport>(uri, brion::AccessMode::MODE_READ, gids);
+        auto lookahead = params.report_lookahead;
 
-        return std::make_unique<bbploader::CompartmentData>(std::move(report));
+        return std::make_unique<bbploader::CompartmentData>(std::move(report), lookahead);
     }
 
     std::unique_ptr<IColormapIndexer> _createIndexer(std::unique_ptr<IReportData> &data)
@@ -162,6 +163,16 @@ void ReportLoader::load(
         return;
     }
     auto reportData = handler->createData();
-    ReportFactory::create(model, std::move(reportData));
+
+    auto &params = context.loadParameters;
+    auto isCompartment = params.report_type == ReportType::Compartment;
+    auto preload = isCompartment ? params.report_preload : ReportPreload::None;
+
+    // Compartment frames are already loaded ahead by brion, see report_lookahead
+    auto cache = ReportCache();
+    cache.memoryBudget = size_t(params.report_cache_size) << 20;
+    cache.readAhead = isCompartment ? 0 : cache.readAhead;
+
+    ReportFactory::create(model, std::move(reportData), preload, cache);
 }
 }
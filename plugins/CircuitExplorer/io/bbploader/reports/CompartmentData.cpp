@@ -18,10 +18,16 @@
 
 #include "CompartmentData.h"
 
+#include <api/reports/ReportFrames.h>
+
+#include <algorithm>
+
 namespace bbploader
 {
-CompartmentData::CompartmentData(std::unique_ptr<brion::CompartmentReport> report):
-    _report(std::move(report))
+CompartmentData::CompartmentData(std::unique_ptr<brion::CompartmentReport> report, size_t lookahead):
+    _report(std::move(report)),
+    _lookahead(lookahead),
+    _frameCount(ReportFrames::count(*this))
 {
 }
 
@@ -47,8 +53,21 @@ std::string CompartmentData::getTimeUnit() const noexcept
 
 std::vector<float> CompartmentData::getFrame(double timestamp) const
 {
-    timestamp = glm::clamp(timestamp, getStartTime(), getEndTime() - getTimeStep());
-    auto frameFuture = _report->loadFrame(timestamp);
+    auto buffer = std::vector<float>();
+    getFrame(timestamp, buffer);
+    return buffer;
+}
+
+void CompartmentData::getFrame(double timestamp, std::vector<float> &buffer) const
+{
+    auto index = ReportFrames::toIndex(*this, timestamp);
+
+    auto lock = std::lock_guard(_mutex);
+
+    auto frameFuture = _take(index);
+    _schedule(index);
+
+    // Next frames keep loading while this one is used
     auto frame = frameFuture.get();
     auto &data = frame.data;
 
@@ -57,7 +76,7 @@ std::vector<float> CompartmentData::getFrame(double timestamp) const
         throw std::runtime_error("Null report frame read");
     }
 
-    return *data;
+    buffer.assign(data->begin(), data->end());
 }
 
 std::vector<CellReportMapping> CompartmentData::computeMapping() const noexcept
@@ -89,4 +108,52 @@ std::vector<CellReportMapping> CompartmentData::computeMapping() const noexcept
 
     return mapping;
 }
+
+std::future<brion::Frame> CompartmentData::_take(size_t index) const
+{
+    if (index != _lastIndex)
+    {
+        _backward = index < _lastIndex;
+        _lastIndex = index;
+    }
+
+    // Frames requested before the one needed were skipped (seek or direction change)
+    while (!_pending.empty())
+    {
+        auto pending = std::move(_pending.front());
+        _pending.pop_front();
+        if (pending.index == index)
+        {
+            return std::move(pending.frame);
+        }
+    }
+
+    return _load(index);
+}
+
+void CompartmentData::_schedule(size_t index) const
+{
+    for (size_t i = 1; i <= _lookahead; ++i)
+    {
+        if (_backward ? i > index : index + i >= _frameCount)
+        {
+            break;
+        }
+
+        auto next = _backward ? index - i : index + i;
+        auto isNext = [&](auto &pending) { return pending.index == next; };
+        if (std::any_of(_pending.begin(), _pending.end(), isNext))
+        {
+            continue;
+        }
+
+        _pending.push_back({next, _load(next)});
+    }
+}
+
+std::future<brion::Frame> CompartmentData::_load(size_t index) const
+{
+    auto timestamp = ReportFrames::toTimestamp(*this, index);
+    return _report->loadFrame(timestamp);
+}
 }
@@ -23,18 +23,33 @@
 
 #include <brion/compartmentReport.h>
 
+#include <deque>
+#include <future>
+#include <mutex>
+
 namespace bbploader
 {
+/**
+ * @brief Compartment report adapter that keeps the next frames loading in the background while the current one is
+ * used, in the current playback direction. Frames are only handed out once resolved.
+ */
 class CompartmentData : public IReportData
 {
 public:
-    explicit CompartmentData(std::unique_ptr<brion::CompartmentReport> report);
+    /**
+     * @brief Wraps the given report.
+     *
+     * @param report Report to read.
+     * @param lookahead Number of frames requested ahead of the last one read, 0 to read them on demand.
+     */
+    explicit CompartmentData(std::unique_ptr<brion::CompartmentReport> report, size_t lookahead = 1);
 
     double getStartTime() const noexcept override;
     double getEndTime() const noexcept override;
     double getTimeStep() const noexcept override;
     std::string getTimeUnit() const noexcept override;
     std::vector<float> getFrame(double timestamp) const override;
+    void getFrame(double timestamp, std::vector<float> &buffer) const override;
 
     /**
      * @brief Computes and returns the report mapping
@@ -43,7 +58,24 @@ public:
      */
     std::vector<CellReportMapping> computeMapping() const noexcept;
 
+private:
+    struct PendingFrame
+    {
+        size_t index;
+        std::future<brion::Frame> frame;
+    };
+
+    std::future<brion::Frame> _take(size_t index) const;
+    void _schedule(size_t index) const;
+    std::future<brion::Frame> _load(size_t index) const;
+
 private:
     std::unique_ptr<brion::CompartmentReport> _report;
+    size_t _lookahead;
+    size_t _frameCount;
+    mutable std::mutex _mutex;
+    mutable std::deque<PendingFrame> _pending;
+    mutable size_t _lastIndex = 0;
+    mutable bool _backward = false;
 };
 }
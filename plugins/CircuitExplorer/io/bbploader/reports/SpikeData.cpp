@@ -20,6 +20,8 @@
 
 #include <brayns/utils/MathTypes.h>
 
+#include <api/reports/ReportReadLock.h>
+
 namespace bbploader
 {
 SpikeData::SpikeData(
@@ -54,6 +56,13 @@ std::string SpikeData::getTimeUnit() const noexcept
 }
 
 std::vector<float> SpikeData::getFrame(double timestamp) const
+{
+    auto values = std::vector<float>();
+    getFrame(timestamp, values);
+    return values;
+}
+
+void SpikeData::getFrame(double timestamp, std::vector<float> &values) const
 {
     auto fTimestamp = static_cast<float>(brayns::math::clamp(timestamp, 0., getEndTime()));
 
@@ -61,9 +70,11 @@ std::vector<float> SpikeData::getFrame(double timestamp) const
     auto frameStart = brayns::math::clamp(fTimestamp - _interval, 0.f, limitTimestamp);
     auto frameEnd = brayns::math::clamp(fTimestamp + _interval, 0.f, limitTimestamp);
 
+    auto lock = ReportReadLock::acquire();
     auto spikes = _report->getSpikes(frameStart, frameEnd);
+    lock.unlock();
 
-    auto values = std::vector<float>(_mapping.size(), 0.f);
+    values.assign(_mapping.size(), 0.f);
 
     for (size_t i = 0; i < spikes.size(); ++i)
     {
@@ -81,7 +92,5 @@ std::vector<float> SpikeData::getFrame(double timestamp) const
 
         values[index] = _spikeCalculator.compute(spikeTime, fTimestamp);
     }
-
-    return values;
 }
 }
@@ -35,6 +35,7 @@ public:
     double getTimeStep() const noexcept override;
     std::string getTimeUnit() const noexcept override;
     std::vector<float> getFrame(double timestamp) const override;
+    void getFrame(double timestamp, std::vector<float> &buffer) const override;
 
 private:
     std::unique_ptr<brain::SpikeReportReader> _report;
@@ -18,6 +18,7 @@
 
 #include "VasculaturePopulationLoader.h"
 
+#include <brayns/engine/components/DynamicGeometry.h>
 #include <brayns/engine/components/Geometries.h>
 #include <brayns/engine/geometry/types/Capsule.h>
 
@@ -177,6 +178,7 @@ private:
         auto offsets = _getOffsets(context);
         auto data = _createReportData(context);
         components.add<RadiiReportData>(std::move(data), std::move(offsets), std::move(originalRadii));
+        components.add<brayns::DynamicGeometry>();
         auto &systems = model.getSystems();
         systems.setUpdateSystem<RadiiReportSystem>();
     }
@@ -188,7 +190,11 @@ private:
         auto offsets = _getOffsets(context);
         auto indexer = std::make_unique<OffsetIndexer>(std::move(offsets));
         auto reportData = ReportData{std::move(data), std::move(indexer)};
-        ReportFactory::create(model, std::move(reportData));
+        auto &params = context.params;
+        auto cache = ReportCache();
+        cache.memoryBudget = size_t(params.report_cache_size) << 20;
+        cache.readAhead = params.report_read_ahead;
+        ReportFactory::create(model, std::move(reportData), ReportPreload::None, cache);
     }
 };
 }
@@ -231,6 +231,25 @@ public:
         return reportType != sl::ReportType::None;
     }
 
+    static ReportPreload getPreload(const sl::NodeLoadContext &context)
+    {
+        auto &params = context.params;
+        if (params.report_type == sl::ReportType::Spikes)
+        {
+            return ReportPreload::None;
+        }
+        return params.report_preload;
+    }
+
+    static ReportCache getCache(const sl::NodeLoadContext &context)
+    {
+        auto &params = context.params;
+        auto cache = ReportCache();
+        cache.memoryBudget = size_t(params.report_cache_size) << 20;
+        cache.readAhead = params.report_read_ahead;
+        return cache;
+    }
+
     static ReportData createReportData(
         const sl::NodeLoadContext &context,
         const std::vector<CellCompartments> &compartments)
@@ -259,6 +278,8 @@ void NeuronReportFactory::create(NodeLoadContext &context, const std::vector<Cel
     }
 
     auto reportData = ReportHandler::createReportData(context, compartments);
-    ReportFactory::create(context.model, std::move(reportData));
+    auto preload = ReportHandler::getPreload(context);
+    auto cache = ReportHandler::getCache(context);
+    ReportFactory::create(context.model, std::move(reportData), preload, cache);
 }
 }
@@ -20,6 +20,8 @@
 
 #include <brayns/utils/MathTypes.h>
 
+#include <api/reports/ReportReadLock.h>
+
 namespace
 {
 static inline constexpr double sonataEpsilon = 1e-6;
@@ -66,7 +68,10 @@ std::vector<float> SonataReportData::getFrame(double timestamp) const
     auto [start, end, dt] = _population.getTimes();
     timestamp = brayns::math::clamp(timestamp, start, end - dt);
     auto endTime = timestamp + dt;
+
+    auto lock = ReportReadLock::acquire();
     auto frame = _population.get(_selection, timestamp, endTime);
+    lock.unlock();
 
     if (frame.data.empty())
     {
@@ -18,11 +18,28 @@
 
 #include "SonataSpikeData.h"
 
-#include <ranges>
-#include <unordered_set>
-
 #include <brayns/utils/MathTypes.h>
 
+#include <api/reports/ReportReadLock.h>
+
+namespace
+{
+class SpikeStoreLoader
+{
+public:
+    static SpikeStore load(
+        const bbp::sonata::SpikeReader::Population &population,
+        const bbp::sonata::Selection &selection)
+    {
+        auto ids = selection.flatten();
+        auto lock = ReportReadLock::acquire();
+        auto spikes = population.get(selection);
+        lock.unlock();
+        return SpikeStore(ids, spikes);
+    }
+};
+}
+
 namespace sonataloader
 {
 SonataSpikeData::SonataSpikeData(
@@ -32,8 +49,7 @@ SonataSpikeData::SonataSpikeData(
     float interval):
     _reader(bbp::sonata::SpikeReader(reportPath)),
     _population(_reader.openPopulation(population)),
-    _selection(std::move(selection)),
-    _mapping(SpikeMappingGenerator::generate(_selection.flatten())),
+    _spikes(SpikeStoreLoader::load(_population, selection)),
     _calculator(interval),
     _interval(interval)
 {
@@ -63,37 +79,23 @@ std::string SonataSpikeData::getTimeUnit() const noexcept
 }
 
 std::vector<float> SonataSpikeData::getFrame(double timestamp) const
+{
+    auto data = std::vector<float>();
+    getFrame(timestamp, data);
+    return data;
+}
+
+void SonataSpikeData::getFrame(double timestamp, std::vector<float> &data) const
 {
     auto frameStart = brayns::math::clamp(timestamp - _interval, _start, _end);
     auto frameEnd = brayns::math::clamp(timestamp + _interval, _start, _end);
+    auto currentTime = static_cast<float>(timestamp);
 
-    auto spikes = _population.get({}, frameStart, frameEnd);
-
-    auto values = _selection.flatten();
-    auto selection = std::unordered_set<bbp::sonata::Selection::Value>(values.begin(), values.end());
-
-    auto notSelected = [&](const auto &spike) { return !selection.contains(spike.first); };
-    auto [first, last] = std::ranges::remove_if(spikes, notSelected);
-    spikes.erase(first, last);
-
-    auto data = std::vector<float>(_mapping.size(), 0.f);
-
-    for (size_t i = 0; i < spikes.size(); ++i)
-    {
-        auto &spike = spikes[i];
-        auto nodeId = spike.first;
-        auto spikeTime = static_cast<float>(spike.second);
-        auto it = _mapping.find(nodeId);
-
-        if (it == _mapping.end())
-        {
-            continue;
-        }
+    data.assign(_spikes.getCellCount(), 0.f);
 
-        auto index = it->second;
-        data[index] = _calculator.compute(spikeTime, static_cast<float>(timestamp));
-    }
-
-    return data;
+    _spikes.forEach(
+        static_cast<float>(frameStart),
+        static_cast<float>(frameEnd),
+        [&](size_t index, float spikeTime) { data[index] = _calculator.compute(spikeTime, currentTime); });
 }
 }
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <api/reports/IReportData.h>
+#include <api/reports/SpikeStore.h>
 #include <api/reports/SpikeUtils.h>
 
 #include <bbp/sonata/report_reader.h>
@@ -39,12 +40,12 @@ public:
     double getTimeStep() const noexcept override;
     std::string getTimeUnit() const noexcept override;
     std::vector<float> getFrame(double timestamp) const override;
+    void getFrame(double timestamp, std::vector<float> &buffer) const override;
 
 private:
     const bbp::sonata::SpikeReader _reader;
     const bbp::sonata::SpikeReader::Population &_population;
-    const bbp::sonata::Selection _selection;
-    const std::unordered_map<uint64_t, size_t> _mapping;
+    const SpikeStore _spikes;
     const SpikeCalculator _calculator;
     float _interval{};
     double _start{};
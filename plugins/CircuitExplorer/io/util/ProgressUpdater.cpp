@@ -16,7 +16,8 @@ void ProgressUpdater::beginStage(std::string_view message, std::size_t numSubEle
 {
     assert(_currentStageProgress == 0.f);
 
-    _currentMessage = std::string(message);
+    _stageMessage = std::string(message);
+    _currentMessage = _stageMessage;
     _currentStageChunkSize = 1.f / static_cast<float>(numSubElements);
 }
 
@@ -28,6 +29,12 @@ void ProgressUpdater::update(std::size_t numSubElementsCompleted) noexcept
     _callback(_currentMessage, globalProgress);
 }
 
+void ProgressUpdater::update(std::size_t numSubElementsCompleted, std::string_view details)
+{
+    _currentMessage = _stageMessage + " (" + std::string(details) + ")";
+    update(numSubElementsCompleted);
+}
+
 void ProgressUpdater::endStage()
 {
     ++_currentStage;
@@ -9,6 +9,7 @@ public:
 
     void beginStage(std::string_view message, std::size_t numSubElements = 1);
     void update(std::size_t numSubElementsCompleted = 1) noexcept;
+    void update(std::size_t numSubElementsCompleted, std::string_view details);
     void endStage();
     void end(std::string_view message);
 
@@ -20,5 +21,6 @@ private:
     std::size_t _currentStage{};
     float _currentStageChunkSize{};
     float _currentStageProgress{};
+    std::string _stageMessage;
     std::string _currentMessage;
 };
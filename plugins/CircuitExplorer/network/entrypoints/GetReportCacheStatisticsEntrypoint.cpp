@@ -0,0 +1,63 @@
+/* Copyright (c) 2015-2024 EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: nadir.romanguerrero@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "GetReportCacheStatisticsEntrypoint.h"
+
+#include <brayns/network/common/ExtractModel.h>
+
+#include <components/ReportData.h>
+
+GetReportCacheStatisticsEntrypoint::GetReportCacheStatisticsEntrypoint(brayns::ModelManager &models):
+    _models(models)
+{
+}
+
+std::string GetReportCacheStatisticsEntrypoint::getMethod() const
+{
+    return "get-report-cache-statistics";
+}
+
+std::string GetReportCacheStatisticsEntrypoint::getDescription() const
+{
+    return "For circuit models with a report read on demand, return the usage of its frame cache";
+}
+
+void GetReportCacheStatisticsEntrypoint::onRequest(const Request &request)
+{
+    auto params = request.getParams();
+    auto modelId = params.model_id;
+    auto &instance = brayns::ExtractModel::fromId(_models, modelId);
+    const auto &model = instance.getModel();
+    auto &components = model.getComponents();
+
+    auto reportData = components.find<ReportData>();
+    if (!reportData)
+    {
+        throw brayns::JsonRpcException("The model does not have a report");
+    }
+
+    auto cache = dynamic_cast<const PrefetchReportData *>(reportData->data.get());
+    if (!cache)
+    {
+        throw brayns::JsonRpcException("The model report is not read through a frame cache");
+    }
+
+    request.reply(cache->getStatistics());
+}
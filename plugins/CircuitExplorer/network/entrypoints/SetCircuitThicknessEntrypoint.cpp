@@ -79,7 +79,7 @@ private:
         geometries.modified = true;
         for (auto &geometry : geometries.elements)
         {
-            geometry.forEach(
+            geometry.forEachInPlace(
                 [&](brayns::Capsule &capsule)
                 {
                     capsule.r0 *= multiplier;
@@ -93,7 +93,7 @@ private:
         geometries.modified = true;
         for (auto &geometry : geometries.elements)
         {
-            geometry.forEach([&](brayns::Sphere &sphere) { sphere.radius *= multiplier; });
+            geometry.forEachInPlace([&](brayns::Sphere &sphere) { sphere.radius *= multiplier; });
         }
     }
 };
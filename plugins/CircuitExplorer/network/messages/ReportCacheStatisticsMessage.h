@@ -0,0 +1,44 @@
+/* Copyright (c) 2015-2024 EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: nadir.romanguerrero@epfl.ch
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/json/Json.h>
+
+#include <api/reports/PrefetchReportData.h>
+
+namespace brayns
+{
+template<>
+struct JsonAdapter<PrefetchStatistics> : ObjectAdapter<PrefetchStatistics>
+{
+    static JsonObjectInfo reflect()
+    {
+        auto builder = Builder("ReportCacheStatisticsMessage");
+        builder.get("hits", [](auto &object) { return object.hits; })
+            .description("Number of report frames served from the cache");
+        builder.get("misses", [](auto &object) { return object.misses; })
+            .description("Number of report frames read from disk on request");
+        builder.get("cached_bytes", [](auto &object) { return object.cachedBytes; })
+            .description("Size in bytes of the cached report frames");
+        return builder.build();
+    }
+};
+} // namespace brayns
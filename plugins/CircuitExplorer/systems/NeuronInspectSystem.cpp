@@ -22,9 +22,11 @@
 
 #include <brayns/engine/components/GeometryViews.h>
 
+#include <components/CellPrimitiveRanges.h>
 #include <components/CircuitIds.h>
 
 #include <algorithm>
+#include <stdexcept>
 
 namespace
 {
@@ -33,47 +35,99 @@ struct ResultParameters
     static inline const std::string neuronId = "neuron_id";
 };
 
+class GeometryIndexMap
+{
+public:
+    static size_t find(
+        const brayns::InspectContext &context,
+        const brayns::Components &components,
+        std::unordered_map<OSPGeometricModel, size_t> &indices)
+    {
+        auto &views = components.get<brayns::GeometryViews>().elements;
+        auto handle = context.model.handle();
+        auto it = indices.find(handle);
+
+        // The views may have been replaced since the map was built, and a released handle can be reused
+        if (it == indices.end() || it->second >= views.size() || views[it->second].getHandle().handle() != handle)
+        {
+            indices = _build(views);
+            it = indices.find(handle);
+        }
+
+        if (it == indices.end())
+        {
+            throw std::runtime_error("Inspected geometry does not belong to the morphology model");
+        }
+
+        return it->second;
+    }
+
+private:
+    static std::unordered_map<OSPGeometricModel, size_t> _build(const std::vector<brayns::GeometryView> &views)
+    {
+        auto indices = std::unordered_map<OSPGeometricModel, size_t>();
+        indices.reserve(views.size());
+
+        for (size_t i = 0; i < views.size(); ++i)
+        {
+            auto &handle = views[i].getHandle();
+            indices.emplace(handle.handle(), i);
+        }
+
+        return indices;
+    }
+};
+
 class HittedMorphologyFinder
 {
 public:
-    static size_t findIndex(const brayns::InspectContext &context, brayns::Components &components)
+    static size_t findIndex(size_t geometryIndex, uint32_t primitiveIndex, const brayns::Components &components)
     {
-        auto &views = components.get<brayns::GeometryViews>();
-        auto &elements = views.elements;
-        auto &hitView = context.model;
-
-        auto it = std::find_if(
-            elements.begin(),
-            elements.end(),
-            [&](const brayns::GeometryView &view)
-            {
-                auto &handle = view.getHandle();
-                return handle.handle() == hitView.handle();
-            });
-
-        assert(it != elements.end());
-        return std::distance(elements.begin(), it);
+        auto &ranges = components.get<CellPrimitiveRanges>();
+        auto &offsets = ranges.cellOffsets;
+        auto firstCell = ranges.geometryCells[geometryIndex];
+        auto globalIndex = offsets[firstCell] + primitiveIndex;
+
+        // Cells are sorted by primitive offset so the lookup is logarithmic in the cell count
+        auto cell = std::upper_bound(offsets.begin(), offsets.end(), globalIndex);
+        assert(cell != offsets.begin());
+        return std::distance(offsets.begin(), cell) - 1;
     }
 };
 }
 
 brayns::InspectResultData SomaInspectSystem::execute(
     const brayns::InspectContext &context,
-    brayns::Components &components)
+    const brayns::Components &components)
 {
-    auto &ids = components.get<CircuitIds>();
     brayns::InspectResultData result;
-    result.set(ResultParameters::neuronId, ids.elements[context.primitiveIndex]);
+    result.set(ResultParameters::neuronId, getElementId(context, components));
     return result;
 }
 
-brayns::InspectResultData MorphologyInspectSystem::execute(
+uint64_t SomaInspectSystem::getElementId(
     const brayns::InspectContext &context,
-    brayns::Components &components)
+    const brayns::Components &components)
 {
-    auto hittedIndex = HittedMorphologyFinder::findIndex(context, components);
     auto &ids = components.get<CircuitIds>();
+    return ids.elements[context.primitiveIndex];
+}
+
+brayns::InspectResultData MorphologyInspectSystem::execute(
+    const brayns::InspectContext &context,
+    const brayns::Components &components)
+{
     brayns::InspectResultData result;
-    result.set(ResultParameters::neuronId, ids.elements[hittedIndex]);
+    result.set(ResultParameters::neuronId, getElementId(context, components));
     return result;
 }
+
+uint64_t MorphologyInspectSystem::getElementId(
+    const brayns::InspectContext &context,
+    const brayns::Components &components)
+{
+    auto geometryIndex = GeometryIndexMap::find(context, components, _geometryIndices);
+    auto hittedIndex = HittedMorphologyFinder::findIndex(geometryIndex, context.primitiveIndex, components);
+    auto &ids = components.get<CircuitIds>();
+    return ids.elements[hittedIndex];
+}
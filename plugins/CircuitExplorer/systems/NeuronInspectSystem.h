@@ -22,14 +22,26 @@
 
 #include <brayns/engine/model/systemtypes/InspectSystem.h>
 
+#include <unordered_map>
+
 class SomaInspectSystem : public brayns::InspectSystem
 {
 public:
-    brayns::InspectResultData execute(const brayns::InspectContext &context, brayns::Components &components) override;
+    brayns::InspectResultData execute(
+        const brayns::InspectContext &context,
+        const brayns::Components &components) override;
+    uint64_t getElementId(const brayns::InspectContext &context, const brayns::Components &components) override;
 };
 
 class MorphologyInspectSystem : public brayns::InspectSystem
 {
 public:
-    brayns::InspectResultData execute(const brayns::InspectContext &context, brayns::Components &components) override;
+    brayns::InspectResultData execute(
+        const brayns::InspectContext &context,
+        const brayns::Components &components) override;
+    uint64_t getElementId(const brayns::InspectContext &context, const brayns::Components &components) override;
+
+private:
+    // Geometry index of each geometric model handle, built on first inspection
+    std::unordered_map<OSPGeometricModel, size_t> _geometryIndices;
 };
@@ -37,7 +37,7 @@ public:
     {
         auto &geometry = _getGeometry(components);
         size_t i = 0;
-        geometry.forEach(
+        geometry.forEachInPlace(
             [&](brayns::Capsule &primitive)
             {
                 auto index = i++ * 2;
@@ -50,7 +50,7 @@ public:
     {
         auto &geometry = _getGeometry(components);
         size_t i = 0;
-        geometry.forEach(
+        geometry.forEachInPlace(
             [&](brayns::Capsule &primitive)
             {
                 const auto offset = offsets[i++];
@@ -64,6 +64,7 @@ private:
     {
         auto &geometries = components.get<brayns::Geometries>();
         assert(geometries.elements.size() == 1);
+        geometries.modified = true;
         return geometries.elements.back();
     }
 };
@@ -96,6 +97,6 @@ bool RadiiReportSystem::shouldExecute(brayns::Components &components)
 void RadiiReportSystem::execute(brayns::Components &components, double frameTimestamp)
 {
     auto &report = components.get<RadiiReportData>();
-    auto frameData = report.data->getFrame(frameTimestamp);
-    RadiiSetter::fromFrame(components, report.offsets, frameData);
+    report.data->getFrame(frameTimestamp, report.frame);
+    RadiiSetter::fromFrame(components, report.offsets, report.frame);
 }
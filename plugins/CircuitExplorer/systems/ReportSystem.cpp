@@ -30,6 +30,88 @@
 #include <components/ColorHandler.h>
 #include <components/ReportData.h>
 
+#include <algorithm>
+
+namespace
+{
+class ColormapUpdater
+{
+public:
+    /**
+     * @brief Flags the geometry views for commit if they still reference the colormap buffers, which have been
+     * updated in place.
+     *
+     * @return false if the buffers were reallocated or the views colored otherwise, and they must be bound again.
+     */
+    static bool updateInPlace(const brayns::ColorMap &colorMap, const ReportData &report, brayns::GeometryViews &views)
+    {
+        if (!_isBound(colorMap, report.binding, views))
+        {
+            return false;
+        }
+
+        for (auto &view : views.elements)
+        {
+            view.notifyColorsChanged();
+        }
+        views.modified = true;
+        return true;
+    }
+
+    /**
+     * @brief Binds the colormap buffers to the geometry views and records the binding.
+     */
+    static void bind(
+        const brayns::ColorMap &colorMap,
+        IColorHandler &painter,
+        const brayns::Geometries &geometries,
+        ReportData &report,
+        brayns::GeometryViews &views)
+    {
+        painter.colorByColormap(colorMap, geometries, views);
+
+        auto &binding = report.binding;
+        binding.indices = colorMap.indices.data();
+        binding.indexCount = colorMap.indices.size();
+        binding.colors = colorMap.colors.data();
+        binding.colorCount = colorMap.colors.size();
+
+        auto &elements = views.elements;
+        binding.viewVersions.resize(elements.size());
+        std::transform(
+            elements.begin(),
+            elements.end(),
+            binding.viewVersions.begin(),
+            [](auto &view) { return view.getColorVersion(); });
+    }
+
+private:
+    static bool _isBound(
+        const brayns::ColorMap &colorMap,
+        const ColormapBinding &binding,
+        const brayns::GeometryViews &views)
+    {
+        if (binding.indices != colorMap.indices.data() || binding.indexCount != colorMap.indices.size())
+        {
+            return false;
+        }
+        if (binding.colors != colorMap.colors.data() || binding.colorCount != colorMap.colors.size())
+        {
+            return false;
+        }
+
+        auto &elements = views.elements;
+        auto &versions = binding.viewVersions;
+        return std::equal(
+            elements.begin(),
+            elements.end(),
+            versions.begin(),
+            versions.end(),
+            [](auto &view, auto version) { return view.getColorVersion() == version; });
+    }
+};
+}
+
 bool ReportSystem::isEnabled(brayns::Components &components)
 {
     auto &info = components.get<brayns::SimulationInfo>();
@@ -61,15 +143,21 @@ void ReportSystem::execute(brayns::Components &components, double frameTimestamp
     auto &colorRamp = components.get<brayns::ColorRamp>();
     auto &colorMap = components.getOrAdd<brayns::ColorMap>();
 
-    colorMap.colors = ColorRampUtils::createSampleBuffer(colorRamp);
+    auto colors = ColorRampUtils::createSampleBuffer(colorRamp);
+    colorMap.colors.assign(colors.begin(), colors.end());
     auto &range = colorRamp.getValuesRange();
 
     auto &report = components.get<ReportData>();
-    auto frameData = report.data->getFrame(frameTimestamp);
-    colorMap.indices = report.indexer->generate(frameData, range);
+    report.data->getFrame(frameTimestamp, report.frame);
+    report.indexer->generate(report.frame, range, colorMap.indices);
+
+    auto &views = components.get<brayns::GeometryViews>();
+    if (ColormapUpdater::updateInPlace(colorMap, report, views))
+    {
+        return;
+    }
 
     auto &painter = *components.get<ColorHandler>().handler;
     auto &geometries = components.get<brayns::Geometries>();
-    auto &views = components.get<brayns::GeometryViews>();
-    painter.colorByColormap(colorMap, geometries, views);
+    ColormapUpdater::bind(colorMap, painter, geometries, report, views);
 }
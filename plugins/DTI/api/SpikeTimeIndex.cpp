@@ -0,0 +1,114 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "SpikeTimeIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+class BucketSize
+{
+public:
+    /**
+     * @brief Widens the buckets so there are never more buckets than spikes.
+     */
+    static float compute(const std::vector<dti::Spike> &spikes, float bucketSize)
+    {
+        auto duration = spikes.back().time - spikes.front().time;
+        auto minSize = duration / static_cast<float>(spikes.size());
+        return std::max({bucketSize, minSize, std::numeric_limits<float>::min()});
+    }
+};
+}
+
+namespace dti
+{
+SpikeTimeIndex::SpikeTimeIndex(std::vector<Spike> spikes, const GidToStreamlines &gidToStreamlines, float bucketSize)
+{
+    auto end = std::remove_if(
+        spikes.begin(),
+        spikes.end(),
+        [&](auto &spike)
+        {
+            auto it = gidToStreamlines.find(spike.gid);
+            return it == gidToStreamlines.end() || it->second.empty();
+        });
+    spikes.erase(end, spikes.end());
+
+    if (spikes.empty())
+    {
+        return;
+    }
+
+    std::stable_sort(spikes.begin(), spikes.end(), [](auto &left, auto &right) { return left.time < right.time; });
+
+    _times.reserve(spikes.size());
+    _offsets.reserve(spikes.size() + 1);
+    _offsets.push_back(0);
+
+    for (auto &spike : spikes)
+    {
+        auto &streamlines = gidToStreamlines.at(spike.gid);
+        _times.push_back(spike.time);
+        for (auto streamline : streamlines)
+        {
+            _streamlines.push_back(static_cast<uint32_t>(streamline));
+        }
+        _offsets.push_back(_streamlines.size());
+    }
+
+    _startTime = _times.front();
+    _invBucketSize = 1.f / BucketSize::compute(spikes, bucketSize);
+
+    auto bucketCount = static_cast<size_t>((_times.back() - _startTime) * _invBucketSize) + 1;
+    _buckets.resize(bucketCount + 1, 0);
+    for (auto time : _times)
+    {
+        ++_buckets[_getBucket(time) + 1];
+    }
+    for (size_t i = 1; i < _buckets.size(); ++i)
+    {
+        _buckets[i] += _buckets[i - 1];
+    }
+}
+
+size_t SpikeTimeIndex::getSpikeCount() const noexcept
+{
+    return _times.size();
+}
+
+size_t SpikeTimeIndex::_getBucket(float time) const noexcept
+{
+    auto bucket = std::floor((time - _startTime) * _invBucketSize);
+    auto lastBucket = _buckets.size() - 2;
+    if (!(bucket > 0.f))
+    {
+        return 0;
+    }
+    if (bucket >= static_cast<float>(lastBucket))
+    {
+        return lastBucket;
+    }
+    return static_cast<size_t>(bucket);
+}
+}
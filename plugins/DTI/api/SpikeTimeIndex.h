@@ -0,0 +1,100 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible Author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace dti
+{
+struct Spike
+{
+    float time;
+    uint32_t gid;
+};
+
+/**
+ * @brief Spikes sorted by time and grouped in fixed size time buckets, each spike storing the list of streamlines
+ * it affects, so a frame only visits the spikes of its time window.
+ */
+class SpikeTimeIndex
+{
+public:
+    using GidToStreamlines = std::unordered_map<uint64_t, std::vector<size_t>>;
+
+    SpikeTimeIndex() = default;
+
+    /**
+     * @brief Builds the index, spikes whose gid has no streamline are discarded.
+     *
+     * @param spikes Spikes in any order.
+     * @param gidToStreamlines Streamline indices affected by each gid.
+     * @param bucketSize Minimal time span of a bucket.
+     */
+    SpikeTimeIndex(std::vector<Spike> spikes, const GidToStreamlines &gidToStreamlines, float bucketSize);
+
+    /**
+     * @brief Calls callback(time, streamlines, streamlineCount) for each spike with start <= time <= end, by
+     * ascending time.
+     */
+    template<typename Callback>
+    void forEach(float start, float end, Callback &&callback) const
+    {
+        if (_times.empty() || end < start)
+        {
+            return;
+        }
+
+        auto bucket = _getBucket(start);
+        auto lastBucket = _getBucket(end);
+
+        for (auto i = _buckets[bucket], last = _buckets[lastBucket + 1]; i < last; ++i)
+        {
+            auto time = _times[i];
+            if (time < start)
+            {
+                continue;
+            }
+            if (time > end)
+            {
+                break;
+            }
+            auto offset = _offsets[i];
+            callback(time, &_streamlines[offset], _offsets[i + 1] - offset);
+        }
+    }
+
+    size_t getSpikeCount() const noexcept;
+
+private:
+    size_t _getBucket(float time) const noexcept;
+
+private:
+    float _startTime = 0.f;
+    float _invBucketSize = 0.f;
+    std::vector<size_t> _buckets;
+    std::vector<float> _times;
+    std::vector<size_t> _offsets;
+    std::vector<uint32_t> _streamlines;
+};
+}
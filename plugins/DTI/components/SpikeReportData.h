@@ -20,26 +20,18 @@
 
 #pragma once
 
-#include <brain/spikeReportReader.h>
+#include <api/SpikeTimeIndex.h>
 
-#include <memory>
-#include <unordered_map>
 #include <vector>
 
 namespace dti
 {
 struct SpikeReportData
 {
-    struct Spike
-    {
-        float time;
-        uint32_t gid;
-    };
-
-    size_t numStreamlines;
-    std::vector<Spike> spikes;
-    std::unordered_map<uint64_t, std::vector<size_t>> gidToFibers;
+    SpikeTimeIndex spikes;
     float decayTime = 1.f;
     bool lastEnabledFlag = true;
+    // Sorted indices in StreamlineColors of the primitives highlighted by the last frame
+    std::vector<size_t> highlights;
 };
 }
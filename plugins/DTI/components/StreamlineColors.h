@@ -26,8 +26,14 @@
 
 namespace dti
 {
+/**
+ * @brief Per primitive colors of all the streamlines stored in one persistent buffer. Each view shares its slice of
+ * the buffer, so colors can be updated in place and the buffer must never be reallocated.
+ */
 struct StreamlineColors
 {
-    std::vector<std::vector<brayns::Vector4f>> elements;
+    std::vector<brayns::Vector4f> defaults;
+    std::vector<brayns::Vector4f> colors;
+    std::vector<size_t> offsets;
 };
 }
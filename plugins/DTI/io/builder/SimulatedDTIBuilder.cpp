@@ -68,10 +68,10 @@ public:
     {
     }
 
-    std::vector<dti::SpikeReportData::Spike> readAll()
+    std::vector<dti::Spike> readAll()
     {
         auto allSpikes = _reader.getSpikes(0.f, _reader.getEndTime());
-        auto result = std::vector<dti::SpikeReportData::Spike>();
+        auto result = std::vector<dti::Spike>();
         result.reserve(allSpikes.size());
         for (auto &spike : allSpikes)
         {
@@ -135,11 +135,11 @@ void SimulatedDTIBuilder::buildSimulation(const std::string &path, float spikeDe
     auto spikes = spikeReader.readAll();
     auto endTime = spikeReader.getEndTime();
 
+    auto gidToFibers = GIDsToFibersMapping::generate(_gidRows, _streamlines);
+
     auto &components = model.getComponents();
     auto &spikeData = components.add<SpikeReportData>();
-    spikeData.numStreamlines = _streamlines.size();
-    spikeData.spikes = std::move(spikes);
-    spikeData.gidToFibers = GIDsToFibersMapping::generate(_gidRows, _streamlines);
+    spikeData.spikes = SpikeTimeIndex(std::move(spikes), gidToFibers, spikeDecayTime);
     spikeData.decayTime = spikeDecayTime;
 
     components.add<brayns::SimulationInfo>(0.f, endTime, 0.01f);
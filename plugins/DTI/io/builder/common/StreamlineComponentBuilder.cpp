@@ -36,8 +36,6 @@ namespace
 using StreamlineMap = std::map<uint64_t, dti::StreamlineData>;
 using StreamlineGeometry = std::vector<brayns::Capsule>;
 using StreamlineGeometries = std::vector<StreamlineGeometry>;
-using StreamlineColor = std::vector<brayns::Vector4f>;
-using StreamlineColors = std::vector<StreamlineColor>;
 
 class GeometryGenerator
 {
@@ -79,15 +77,15 @@ public:
         auto count = inputGeometry.size();
         auto &geometries = _addGeometryComponent(count);
         auto &views = _addViewComponent(count);
-        auto &colors = _addColorComponent(count);
+        auto &colors = _addColorComponent(inputGeometry);
 
         for (size_t i = 0; i < inputGeometry.size(); ++i)
         {
-            auto &capsules = inputGeometry[i];
-            auto &color = colors.emplace_back(dti::StreamlineColorGenerator::generate(capsules));
-            auto &geometry = geometries.emplace_back(std::move(capsules));
+            auto &geometry = geometries.emplace_back(std::move(inputGeometry[i]));
             auto &view = views.emplace_back(geometry);
-            view.setColorPerPrimitive(ospray::cpp::SharedData(color));
+            auto offset = colors.offsets[i];
+            auto colorCount = colors.offsets[i + 1] - offset;
+            view.setColorPerPrimitive(ospray::cpp::SharedData(colors.colors.data() + offset, colorCount));
         }
     }
 
@@ -115,11 +113,20 @@ private:
         return views;
     }
 
-    std::vector<std::vector<brayns::Vector4f>> &_addColorComponent(size_t count)
+    dti::StreamlineColors &_addColorComponent(const StreamlineGeometries &inputGeometry)
     {
-        auto &colorComponent = _model.getComponents().add<dti::StreamlineColors>();
-        auto &colors = colorComponent.elements;
-        colors.reserve(count);
+        auto &colors = _model.getComponents().add<dti::StreamlineColors>();
+        auto &defaults = colors.defaults;
+        auto &offsets = colors.offsets;
+        offsets.reserve(inputGeometry.size() + 1);
+        offsets.push_back(0);
+        for (auto &capsules : inputGeometry)
+        {
+            auto color = dti::StreamlineColorGenerator::generate(capsules);
+            defaults.insert(defaults.end(), color.begin(), color.end());
+            offsets.push_back(defaults.size());
+        }
+        colors.colors = defaults;
         return colors;
     }
 
@@ -20,139 +20,135 @@
 
 #include "SpikeReportSystem.h"
 
+#include <algorithm>
 #include <utility>
 
-#include <brayns/engine/components/Geometries.h>
 #include <brayns/engine/components/GeometryViews.h>
 #include <brayns/engine/components/SimulationInfo.h>
-#include <brayns/engine/geometry/types/Capsule.h>
 
-#include <api/StreamlineColorGenerator.h>
 #include <components/SpikeReportData.h>
 #include <components/StreamlineColors.h>
 
-#include <ospray/ospray_cpp/ext/rkcommon.h>
-
 namespace
 {
 /**
- * @brief Applies default Streamline colors to the geometry view
+ * @brief Uses the spike value to generate a normalized index that will be used to know
+ * which primitive of each streamline to highlight
  */
-class DefaultColor
+class SpikeFrameProcessor
 {
 public:
-    static void restore(brayns::Components &components)
+    static std::vector<size_t> process(
+        const dti::SpikeReportData &data,
+        const dti::StreamlineColors &colors,
+        float frameTime)
     {
-        auto &geometries = components.get<brayns::Geometries>();
-        auto &views = components.get<brayns::GeometryViews>();
-        auto &colors = components.get<dti::StreamlineColors>();
-
-        for (size_t i = 0; i < geometries.elements.size(); ++i)
-        {
-            auto capsules = geometries.elements[i].as<brayns::Capsule>();
+        auto &offsets = colors.offsets;
+        auto invDecayTime = 1.f / data.decayTime;
 
-            auto &color = colors.elements[i];
-            color = dti::StreamlineColorGenerator::generate(*capsules);
+        std::vector<size_t> result;
 
-            auto &view = views.elements[i];
-            view.setColorPerPrimitive(ospray::cpp::SharedData(color));
-        }
-        views.modified = true;
+        data.spikes.forEach(
+            frameTime,
+            frameTime + data.decayTime,
+            [&](float time, const uint32_t *streamlines, size_t streamlineCount)
+            {
+                auto normalizedSpikeLife = std::max(0.f, (time - frameTime) * invDecayTime);
+                // Spike visualization is over
+                if (normalizedSpikeLife > 1.f)
+                {
+                    return;
+                }
+
+                for (size_t i = 0; i < streamlineCount; ++i)
+                {
+                    auto streamlineIndex = streamlines[i];
+                    auto offset = offsets[streamlineIndex];
+                    auto primitiveCount = offsets[streamlineIndex + 1] - offset;
+                    if (primitiveCount == 0)
+                    {
+                        continue;
+                    }
+
+                    auto streamlineLength = primitiveCount - 1;
+                    auto index = static_cast<size_t>(normalizedSpikeLife * static_cast<float>(streamlineLength));
+                    index = std::min(index, streamlineLength);
+                    result.push_back(offset + index);
+                }
+            });
+
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
     }
 };
 
 /**
- * @brief Applies a spike highlight to the streamline's geometry view
+ * @brief Updates the spike highlights in the persistent streamline color buffer, only touching the primitives whose
+ * highlight changed since the last frame and flagging only their views for commit.
  */
 class SimulationColorPainter
 {
 public:
-    static void paint(brayns::Components &components, const std::vector<std::vector<float>> &streamlineValues)
+    static void paint(brayns::Components &components, std::vector<size_t> highlights)
     {
         auto &views = components.get<brayns::GeometryViews>();
-        auto &geometries = components.get<brayns::Geometries>();
         auto &colors = components.get<dti::StreamlineColors>();
+        auto &data = components.get<dti::SpikeReportData>();
+        auto &previous = data.highlights;
 
-        for (size_t i = 0; i < streamlineValues.size(); ++i)
+        auto changed = false;
+        auto notify = [&](size_t primitive)
         {
-            auto &streamlineData = streamlineValues[i];
-            if (streamlineData.empty())
+            auto &offsets = colors.offsets;
+            auto it = std::upper_bound(offsets.begin(), offsets.end(), primitive);
+            auto streamlineIndex = static_cast<size_t>(it - offsets.begin()) - 1;
+            views.elements[streamlineIndex].notifyColorsChanged();
+            changed = true;
+        };
+
+        _forEachMissing(
+            previous,
+            highlights,
+            [&](size_t primitive)
             {
-                continue;
-            }
-
-            auto &geometry = geometries.elements[i];
-            auto &color = colors.elements[i];
-            auto &view = views.elements[i];
+                colors.colors[primitive] = colors.defaults[primitive];
+                notify(primitive);
+            });
+
+        _forEachMissing(
+            highlights,
+            previous,
+            [&](size_t primitive)
+            {
+                colors.colors[primitive] = brayns::Vector4f(1.f);
+                notify(primitive);
+            });
 
-            auto primitiveCount = geometry.numPrimitives();
-            auto streamlineLength = primitiveCount - 1;
+        previous = std::move(highlights);
 
-            for (auto value : streamlineData)
-            {
-                auto index = static_cast<size_t>(value * streamlineLength);
-                index = std::clamp(index, 0ul, streamlineLength);
-                color[index] = brayns::Vector4f(1.f);
-                view.setColorPerPrimitive(ospray::cpp::SharedData(color));
-            }
+        if (changed)
+        {
+            views.modified = true;
         }
-        views.modified = true;
     }
-};
 
-/**
- * @brief Uses the spike value to generate a normalized index that will be used to know
- * which primitive of each streamline to update
- */
-class SpikeFrameProcessor
-{
-public:
-    static std::vector<std::vector<float>> process(const dti::SpikeReportData &data, float frameTime)
+private:
+    template<typename Callback>
+    static void _forEachMissing(const std::vector<size_t> &source, const std::vector<size_t> &other, Callback callback)
     {
-        auto &spikes = data.spikes;
-        auto invDecayTime = 1.f / data.decayTime;
-        auto &gidMap = data.gidToFibers;
-
-        std::vector<std::vector<float>> result(data.numStreamlines);
-
-        for (size_t i = 0; i < spikes.size(); ++i)
+        auto it = other.begin();
+        for (auto value : source)
         {
-            auto &spike = spikes[i];
-            if (spike.time < frameTime)
-            {
-                continue;
-            }
-
-            auto normalizedSpikeLife = std::max(0.f, (spike.time - frameTime) * invDecayTime);
-            // Spike visualization is over
-            if (normalizedSpikeLife > 1.f)
-            {
-                continue;
-            }
-
-            auto it = gidMap.find(spike.gid);
-            if (it == gidMap.end())
+            it = std::lower_bound(it, other.end(), value);
+            if (it != other.end() && *it == value)
             {
                 continue;
             }
-
-            auto &affectedStreamlines = it->second;
-            if (affectedStreamlines.empty())
-            {
-                continue;
-            }
-
-            for (const auto streamlineIndex : affectedStreamlines)
-            {
-                auto &streamlineBuffer = result[streamlineIndex];
-                streamlineBuffer.push_back(normalizedSpikeLife);
-            }
+            callback(value);
         }
-
-        return result;
     }
 };
-
 }
 
 namespace dti
@@ -168,7 +164,7 @@ bool SpikeReportSystem::isEnabled(brayns::Components &components)
     auto &data = components.get<SpikeReportData>();
     if (std::exchange(data.lastEnabledFlag, false))
     {
-        DefaultColor::restore(components);
+        SimulationColorPainter::paint(components, {});
     }
 
     return false;
@@ -182,9 +178,10 @@ bool SpikeReportSystem::shouldExecute(brayns::Components &components)
 
 void SpikeReportSystem::execute(brayns::Components &components, double frameTimestamp)
 {
-    auto &info = components.get<brayns::SimulationInfo>();
     auto &spikeData = components.get<dti::SpikeReportData>();
-    auto data = SpikeFrameProcessor::process(spikeData, frameTimestamp);
-    SimulationColorPainter::paint(components, data);
+    auto &colors = components.get<dti::StreamlineColors>();
+    auto frameTime = static_cast<float>(frameTimestamp);
+    auto highlights = SpikeFrameProcessor::process(spikeData, colors, frameTime);
+    SimulationColorPainter::paint(components, std::move(highlights));
 }
 }
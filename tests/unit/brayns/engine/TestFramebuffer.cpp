@@ -21,6 +21,7 @@
 #include <doctest/doctest.h>
 
 #include <brayns/engine/framebuffer/Framebuffer.h>
+#include <brayns/engine/framebuffer/FramebufferPool.h>
 #include <brayns/engine/framebuffer/types/ProgressiveFrameHandler.h>
 #include <brayns/engine/framebuffer/types/StaticFrameHandler.h>
 
@@ -83,8 +84,9 @@ TEST_CASE("Progressive frame handler")
         CHECK(!handler.hasNewAccumulationFrame());
 
         handler.incrementAccumFrames();
+        CHECK(handler.getAccumulationFrameCount() == 0);
         handler.incrementAccumFrames();
-        CHECK(handler.getAccumulationFrameCount() == 2);
+        CHECK(handler.getAccumulationFrameCount() == 1);
         CHECK(handler.hasNewAccumulationFrame());
 
         handler.clear();
@@ -95,6 +97,40 @@ TEST_CASE("Progressive frame handler")
         CHECK(handler.getAccumulationFrameCount() == 0);
         CHECK(!handler.hasNewAccumulationFrame());
     }
+    SUBCASE("Adaptive resolution")
+    {
+        auto handler = brayns::ProgressiveFrameHandler(4, 33);
+        handler.setFrameSize(brayns::Vector2ui(400, 400));
+        handler.commit();
+
+        handler.incrementAccumFrames();
+        handler.setFrameTime(0.1f);
+        CHECK(handler.getImage(brayns::FramebufferChannel::Color).getWidth() == 100);
+
+        handler.incrementAccumFrames();
+        CHECK(handler.getImage(brayns::FramebufferChannel::Color).getWidth() == 200);
+
+        handler.incrementAccumFrames();
+        CHECK(handler.getImage(brayns::FramebufferChannel::Color).getWidth() == 400);
+        CHECK(handler.getAccumulationFrameCount() == 1);
+
+        handler.clear();
+        handler.incrementAccumFrames();
+        CHECK(handler.getImage(brayns::FramebufferChannel::Color).getWidth() == 100);
+    }
+    SUBCASE("Adaptive start level")
+    {
+        auto handler = brayns::ProgressiveFrameHandler(4, 33);
+        handler.setFrameSize(brayns::Vector2ui(400, 400));
+        handler.commit();
+
+        handler.incrementAccumFrames();
+        handler.setFrameTime(0.005f);
+
+        handler.clear();
+        handler.incrementAccumFrames();
+        CHECK(handler.getImage(brayns::FramebufferChannel::Color).getWidth() == 200);
+    }
 }
 
 TEST_CASE("Static frame handler")
@@ -145,4 +181,61 @@ TEST_CASE("Static frame handler")
         CHECK(handler.getAccumulationFrameCount() == 0);
         CHECK(!handler.hasNewAccumulationFrame());
     }
+    SUBCASE("Pool")
+    {
+        auto pool = brayns::FramebufferPool(1);
+        auto frameSize = brayns::Vector2ui(400, 400);
+        auto handle = static_cast<OSPFrameBuffer>(nullptr);
+        {
+            auto handler = brayns::StaticFrameHandler(pool);
+            handler.setFrameSize(frameSize);
+            CHECK(handler.commit());
+            handle = handler.getHandle().handle();
+        }
+        CHECK(pool.getSize() == 1);
+        {
+            auto handler = brayns::StaticFrameHandler(pool);
+            handler.setFrameSize(frameSize);
+            CHECK(handler.commit());
+            CHECK(handler.getHandle().handle() == handle);
+            CHECK(pool.getSize() == 0);
+
+            handler.setFormat(brayns::PixelFormat::RgbaF32);
+            CHECK(handler.commit());
+            CHECK(handler.getHandle().handle() != handle);
+            CHECK(pool.getSize() == 1);
+        }
+        CHECK(pool.getSize() == 1);
+    }
+    SUBCASE("Pool budget")
+    {
+        auto frameSize = brayns::Vector2ui(400, 400);
+        auto key = brayns::FramebufferKey();
+        key.frameSize = frameSize;
+        key.channels = OSP_FB_COLOR;
+        CHECK(key.getByteSize() == 400 * 400 * 4);
+
+        key.format = brayns::PixelFormat::RgbaF32;
+        key.channels = OSP_FB_COLOR | OSP_FB_DEPTH | OSP_FB_ACCUM;
+        CHECK(key.getByteSize() == 400 * 400 * 36);
+
+        auto pool = brayns::FramebufferPool(8, 2 * 400 * 400 * 4);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            auto handler = brayns::StaticFrameHandler(pool);
+            handler.setAccumulation(false);
+            handler.setFrameSize(frameSize + brayns::Vector2ui(static_cast<uint32_t>(i)));
+            CHECK(handler.commit());
+        }
+        CHECK(pool.getSize() == 1);
+        CHECK(pool.getByteSize() <= 2 * 400 * 400 * 4);
+
+        {
+            auto handler = brayns::StaticFrameHandler(pool);
+            handler.setAccumulation(false);
+            handler.setFrameSize(brayns::Vector2ui(1000, 1000));
+            CHECK(handler.commit());
+        }
+        CHECK(pool.getSize() == 1);
+    }
 }
@@ -72,6 +72,19 @@ TEST_CASE("Geometry")
         CHECK(counter == 3);
         CHECK(geometry.commit());
     }
+    SUBCASE("In place update")
+    {
+        auto geometry = brayns::Geometry(std::vector<brayns::Sphere>(3, brayns::Sphere{brayns::Vector3f(0.f), 1.f}));
+        geometry.commit();
+
+        geometry.forEachInPlace([](brayns::Sphere &sphere) { sphere.radius = 2.f; });
+        CHECK(geometry.commit());
+        CHECK(!geometry.commit());
+
+        auto &spheres = *geometry.as<brayns::Sphere>();
+        CHECK(spheres[0].radius == 2.f);
+        CHECK(spheres[2].radius == 2.f);
+    }
     SUBCASE("Compute bounds")
     {
         auto sphere = brayns::Sphere{brayns::Vector3f(0.f), 10.f};
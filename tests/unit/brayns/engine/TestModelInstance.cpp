@@ -48,6 +48,12 @@ TEST_CASE("ModelInstance")
         instance.setTransform(transform);
         CHECK(bounds.getMin() == brayns::Vector3f(-10.f, 90.f, -10.f));
         CHECK(bounds.getMax() == brayns::Vector3f(10.f, 110.f, 10.f));
+
+        auto &geometries = model->getComponents().get<brayns::Geometries>();
+        geometries.elements.front() = brayns::Geometry(brayns::Sphere{brayns::Vector3f(0.f), 20.f});
+        instance.setTransform(brayns::Transform());
+        CHECK(bounds.getMin() == brayns::Vector3f(-20.f));
+        CHECK(bounds.getMax() == brayns::Vector3f(20.f));
     }
     SUBCASE("Transform")
     {
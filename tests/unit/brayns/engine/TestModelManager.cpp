@@ -21,9 +21,30 @@
 #include <doctest/doctest.h>
 
 #include <brayns/engine/scene/ModelManager.h>
+#include <brayns/utils/Timer.h>
 
 #include <tests/unit/PlaceholderEngine.h>
 
+#include <utility>
+
+namespace
+{
+class RenderingDataSystem : public brayns::DataSystem
+{
+public:
+    void init(brayns::Components &components) override
+    {
+        (void)components;
+    }
+
+    brayns::CommitResult commit(brayns::Components &components) override
+    {
+        (void)components;
+        return {.needsRender = true};
+    }
+};
+}
+
 TEST_CASE("ModelManager")
 {
     BRAYNS_TESTS_PLACEHOLDER_ENGINE
@@ -130,4 +151,87 @@ TEST_CASE("ModelManager")
         CHECK(allInstances.size() == 1);
         CHECK(allInstances[0]->getID() == instance2->getID());
     }
+    SUBCASE("Bulk removal")
+    {
+        auto manager = brayns::ModelManager();
+        auto instances = manager.add(std::vector<std::shared_ptr<brayns::Model>>{
+            std::make_shared<brayns::Model>(""),
+            std::make_shared<brayns::Model>(""),
+            std::make_shared<brayns::Model>(""),
+            std::make_shared<brayns::Model>("")});
+
+        manager.removeModelInstancesById({instances[2]->getID(), instances[0]->getID(), instances[2]->getID()});
+
+        auto &allInstances = manager.getAllModelInstances();
+        CHECK(allInstances.size() == 2);
+        CHECK(allInstances[0]->getID() == 1);
+        CHECK(allInstances[1]->getID() == 3);
+        CHECK(&manager.getModelInstance(3) == allInstances[1].get());
+
+        CHECK_THROWS_AS(manager.removeModelInstancesById({1, 2}), std::invalid_argument);
+        CHECK(allInstances.size() == 2);
+        CHECK_THROWS_AS(manager.getModelInstance(0), std::invalid_argument);
+    }
+    SUBCASE("Read-only access")
+    {
+        auto manager = brayns::ModelManager();
+
+        auto model = std::make_shared<brayns::Model>("");
+        auto &systems = model->getSystems();
+        systems.setDataSystem<RenderingDataSystem>();
+        manager.add(model);
+        manager.commit();
+        CHECK(!manager.commit().needsRender);
+
+        auto &constModel = std::as_const(*model);
+        auto view = constModel.getSystemsView();
+        view.computeBounds(brayns::TransformMatrix());
+        CHECK(!manager.commit().needsRender);
+
+        model->getComponents();
+        CHECK(manager.commit().needsRender);
+    }
+}
+
+// Run with --no-skip
+TEST_CASE("ModelManager benchmark" * doctest::skip())
+{
+    BRAYNS_TESTS_PLACEHOLDER_ENGINE
+
+    constexpr size_t instanceCount = 100'000;
+
+    auto manager = brayns::ModelManager();
+    auto first = manager.add(std::make_shared<brayns::Model>(""));
+
+    auto timer = brayns::Timer();
+    manager.createInstances(first->getID(), instanceCount - 1);
+    auto creation = timer.millis();
+
+    timer.reset();
+    size_t mismatches = 0;
+    for (uint32_t i = 0; i < instanceCount; ++i)
+    {
+        mismatches += manager.getModelInstance(i).getID() != i;
+    }
+    auto lookup = timer.millis();
+    CHECK(mismatches == 0);
+
+    auto ids = std::vector<uint32_t>();
+    ids.reserve(instanceCount / 2);
+    for (uint32_t i = 0; i < instanceCount; i += 2)
+    {
+        ids.push_back(i);
+    }
+
+    timer.reset();
+    manager.removeModelInstancesById(ids);
+    auto removal = timer.millis();
+
+    auto &allInstances = manager.getAllModelInstances();
+    CHECK(allInstances.size() == instanceCount / 2);
+    CHECK(allInstances.front()->getID() == 1);
+    CHECK(allInstances.back()->getID() == instanceCount - 1);
+    CHECK(&manager.getModelInstance(instanceCount - 1) == allInstances.back().get());
+
+    MESSAGE("Creation: " << creation << " ms, lookup: " << lookup << " ms, removal: " << removal << " ms");
 }
@@ -28,11 +28,11 @@ namespace
 class MockBoundsSystem : public brayns::BoundsSystem
 {
 public:
-    brayns::Bounds compute(const brayns::TransformMatrix &matrix, brayns::Components &components) override
+    brayns::Bounds compute(const brayns::TransformMatrix &matrix, const brayns::Components &components) override
     {
-        auto &vector = components.add<brayns::Vector3f>(0.f, 0.f, 0.f);
-        vector = matrix.transformPoint(vector);
-        return brayns::Bounds();
+        (void)components;
+        auto point = matrix.transformPoint(brayns::Vector3f(0.f));
+        return brayns::Bounds(point, point);
     }
 };
 
@@ -76,7 +76,9 @@ public:
 class MockInspectSystem : public brayns::InspectSystem
 {
 public:
-    brayns::InspectResultData execute(const brayns::InspectContext &context, brayns::Components &components) override
+    brayns::InspectResultData execute(
+        const brayns::InspectContext &context,
+        const brayns::Components &components) override
     {
         (void)context;
         (void)components;
@@ -107,12 +109,10 @@ TEST_CASE("Systems")
         auto view = brayns::SystemsView(systems, components);
         auto matrix = brayns::Transform{.translation = brayns::Vector3f(0.f, 0.f, 100.f)}.toMatrix();
 
-        CHECK(!components.has<brayns::Vector3f>());
-
-        view.computeBounds(matrix);
+        auto bounds = view.computeBounds(matrix);
 
-        CHECK(components.has<brayns::Vector3f>());
-        CHECK(components.get<brayns::Vector3f>() == brayns::Vector3f(0.f, 0.f, 100.f));
+        CHECK(bounds.getMin() == brayns::Vector3f(0.f, 0.f, 100.f));
+        CHECK(bounds.getMax() == brayns::Vector3f(0.f, 0.f, 100.f));
     }
     SUBCASE("Color system")
     {
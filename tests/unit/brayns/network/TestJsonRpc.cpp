@@ -21,6 +21,7 @@
 
 #include <doctest/doctest.h>
 
+#include <brayns/network/jsonrpc/JsonRpcFactory.h>
 #include <brayns/network/jsonrpc/JsonRpcParser.h>
 
 #include "MockWebSocket.h"
@@ -121,3 +122,33 @@ TEST_CASE("JsonRpcRequest")
     auto ref = "{client = 3, id = 1, method = test, binary = 6 bytes}";
     CHECK_EQ(test, ref);
 }
+
+TEST_CASE("JsonRpcNotification")
+{
+    auto socket = std::make_shared<MockWebSocket>();
+    auto client = brayns::ClientRef(socket);
+    auto message = brayns::RequestMessage();
+    message.jsonrpc = "2.0";
+    message.method = "test";
+
+    SUBCASE("Binary")
+    {
+        message.id = brayns::RequestId(1);
+        auto request = brayns::JsonRpcRequest(client, message);
+        request.notify(123, "binary");
+        auto &received = socket->getReceivedPackets();
+        CHECK_EQ(received.size(), 1);
+        auto &packet = received.front();
+        CHECK(packet.binary);
+        auto notification = brayns::JsonRpcFactory::notification(message, 123);
+        auto text = brayns::Json::stringify(notification);
+        CHECK_EQ(packet.data.substr(4), text + "binary");
+        CHECK_NE(text.find(R"("method":"test")"), std::string::npos);
+    }
+    SUBCASE("Notification without ID")
+    {
+        auto request = brayns::JsonRpcRequest(client, message);
+        request.notify(123, "binary");
+        CHECK(socket->getReceivedPackets().empty());
+    }
+}
@@ -0,0 +1,94 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <doctest/doctest.h>
+
+#include <brayns/network/common/SimulationPlayback.h>
+#include <brayns/network/jsonrpc/JsonRpcException.h>
+
+TEST_CASE("SimulationPlayback")
+{
+    auto playback = brayns::SimulationPlayback();
+
+    SUBCASE("Forward")
+    {
+        playback.start(2, 4, 1.0, false);
+        CHECK(playback.isPlaying());
+        CHECK_EQ(playback.getFrame(), 2);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 3);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 4);
+        CHECK_FALSE(playback.advance());
+        playback.stop();
+        CHECK_FALSE(playback.isPlaying());
+    }
+    SUBCASE("Backward loop")
+    {
+        playback.start(0, 2, -1.0, true);
+        CHECK_EQ(playback.getFrame(), 2);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 1);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 0);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 2);
+    }
+    SUBCASE("Fractional speed")
+    {
+        playback.start(0, 10, 0.5, false);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 0);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 1);
+        playback.setSpeed(4.0);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 5);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 9);
+        CHECK_FALSE(playback.advance());
+    }
+    SUBCASE("Seek")
+    {
+        playback.start(0, 10, 1.0, false);
+        playback.seek(7);
+        CHECK_EQ(playback.getFrame(), 7);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 7);
+        CHECK(playback.advance());
+        CHECK_EQ(playback.getFrame(), 8);
+        CHECK_THROWS_AS(playback.seek(11), brayns::InvalidParamsException);
+    }
+    SUBCASE("Pause")
+    {
+        playback.start(0, 10, 1.0, false);
+        CHECK_FALSE(playback.isPaused());
+        playback.setPaused(true);
+        CHECK(playback.isPaused());
+        playback.stop();
+        CHECK_FALSE(playback.isPaused());
+    }
+    SUBCASE("Invalid")
+    {
+        CHECK_THROWS_AS(playback.start(5, 4, 1.0, false), brayns::InvalidParamsException);
+        CHECK_THROWS_AS(playback.start(0, 4, 0.0, false), brayns::InvalidParamsException);
+        playback.start(0, 4, 1.0, false);
+        CHECK_THROWS_AS(playback.setSpeed(0.0), brayns::InvalidParamsException);
+    }
+}
@@ -0,0 +1,66 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <doctest/doctest.h>
+
+#include <brayns/network/common/SnapshotSequence.h>
+#include <brayns/network/jsonrpc/JsonRpcException.h>
+
+TEST_CASE("SnapshotSequence")
+{
+    auto simulation = brayns::SimulationParameters();
+    simulation.setStartFrame(2);
+    simulation.setEndFrame(10);
+
+    auto params = brayns::SnapshotSequenceParams();
+
+    SUBCASE("Empty")
+    {
+        CHECK_THROWS_AS(brayns::SnapshotSequence::validate(params, simulation), brayns::InvalidParamsException);
+    }
+    SUBCASE("Camera views")
+    {
+        params.camera_views.resize(3);
+        CHECK_NOTHROW(brayns::SnapshotSequence::validate(params, simulation));
+        CHECK_EQ(brayns::SnapshotSequence::getLength(params), 3);
+    }
+    SUBCASE("Simulation frames")
+    {
+        params.simulation_frames = {2, 5, 10, 5};
+        CHECK_NOTHROW(brayns::SnapshotSequence::validate(params, simulation));
+        CHECK_EQ(brayns::SnapshotSequence::getLength(params), 4);
+    }
+    SUBCASE("Both")
+    {
+        params.camera_views.resize(2);
+        params.simulation_frames = {3, 4};
+        CHECK_NOTHROW(brayns::SnapshotSequence::validate(params, simulation));
+        CHECK_EQ(brayns::SnapshotSequence::getLength(params), 2);
+
+        params.simulation_frames.push_back(5);
+        CHECK_THROWS_AS(brayns::SnapshotSequence::validate(params, simulation), brayns::InvalidParamsException);
+    }
+    SUBCASE("Frame out of range")
+    {
+        params.simulation_frames = {1};
+        CHECK_THROWS_AS(brayns::SnapshotSequence::validate(params, simulation), brayns::InvalidParamsException);
+        params.simulation_frames = {11};
+        CHECK_THROWS_AS(brayns::SnapshotSequence::validate(params, simulation), brayns::InvalidParamsException);
+    }
+}
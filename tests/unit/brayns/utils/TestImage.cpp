@@ -22,6 +22,7 @@
 #include <brayns/utils/image/ImageDecoder.h>
 #include <brayns/utils/image/ImageEncoder.h>
 #include <brayns/utils/image/ImageFormat.h>
+#include <brayns/utils/image/ImageStreamWriter.h>
 
 #include <doctest/doctest.h>
 
@@ -29,7 +30,9 @@
 #include <tests/helpers/TemporaryFilename.h>
 #include <tests/paths.h>
 
+#include <cstdint>
 #include <filesystem>
+#include <sstream>
 
 namespace
 {
@@ -79,6 +82,103 @@ public:
         CHECK(ImageValidator::validate(readImage, image));
     }
 };
+
+class PngChunkValidator
+{
+public:
+    static bool validate(const std::string &data)
+    {
+        constexpr size_t signatureSize = 8;
+        auto offset = signatureSize;
+        auto lastType = std::string();
+
+        while (offset + 12 <= data.size())
+        {
+            auto length = _readUint32(data, offset);
+            if (offset + 12 + length > data.size())
+            {
+                return false;
+            }
+            auto crc = _readUint32(data, offset + 8 + length);
+            if (_computeCrc(data.substr(offset + 4, 4 + length)) != crc)
+            {
+                return false;
+            }
+            lastType = data.substr(offset + 4, 4);
+            offset += 12 + length;
+        }
+
+        return offset == data.size() && lastType == "IEND";
+    }
+
+private:
+    static uint32_t _readUint32(const std::string &data, size_t offset)
+    {
+        auto result = uint32_t(0);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            result = (result << 8) | static_cast<uint8_t>(data[offset + i]);
+        }
+        return result;
+    }
+
+    static uint32_t _computeCrc(const std::string &data)
+    {
+        auto crc = 0xFFFFFFFFu;
+        for (auto byte : data)
+        {
+            crc ^= static_cast<uint8_t>(byte);
+            for (size_t i = 0; i < 8; ++i)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+            }
+        }
+        return ~crc;
+    }
+};
+
+class ImageStreamTest
+{
+public:
+    static void run(const std::string &path)
+    {
+        auto image = brayns::ImageDecoder::load(path);
+        auto format = brayns::ImageFormat::fromFilename(path);
+
+        auto info = brayns::ImageInfo();
+        info.width = image.getWidth();
+        info.height = image.getHeight();
+        info.channelCount = image.getChannelCount();
+        info.channelSize = image.getChannelSize();
+        info.dataType = image.getDataType();
+
+        auto stream = std::ostringstream();
+        auto writer = brayns::ImageStreamWriterFactory::create(stream, info, format);
+
+        constexpr size_t bandHeight = 100;
+        auto band = info;
+
+        for (size_t y = 0; y < info.height; y += bandHeight)
+        {
+            band.height = std::min(bandHeight, info.height - y);
+            auto data = static_cast<const char *>(image.getData(0, y));
+            auto rows = brayns::Image(band, std::string(data, band.getSize()));
+            CHECK_NOTHROW(writer->write(rows));
+        }
+
+        CHECK_THROWS_AS(writer->write(image), std::invalid_argument);
+        CHECK_NOTHROW(writer->finish());
+
+        auto readImage = brayns::Image();
+        CHECK_NOTHROW(readImage = brayns::ImageDecoder::decode(stream.str(), format));
+        CHECK(ImageValidator::validate(readImage, image));
+
+        if (format == "png")
+        {
+            CHECK(PngChunkValidator::validate(stream.str()));
+        }
+    }
+};
 }
 
 TEST_CASE("Image info")
@@ -249,3 +349,19 @@ TEST_CASE("Image encoder")
         ImageWriteTest::run(TestPaths::Images::exr);
     }
 }
+
+TEST_CASE("Image stream writer")
+{
+    CHECK(brayns::ImageStreamWriterFactory::isSupported("png"));
+    CHECK(brayns::ImageStreamWriterFactory::isSupported("exr"));
+    CHECK(!brayns::ImageStreamWriterFactory::isSupported("jpg"));
+
+    SUBCASE("PNG")
+    {
+        ImageStreamTest::run(TestPaths::Images::png);
+    }
+    SUBCASE("EXR")
+    {
+        ImageStreamTest::run(TestPaths::Images::exr);
+    }
+}
@@ -0,0 +1,221 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/utils/Quantizer.h>
+#include <brayns/utils/Timer.h>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+class LegacyIndexer
+{
+public:
+    static std::vector<uint8_t> generate(
+        const std::vector<float> &data,
+        const std::vector<size_t> &offsets,
+        const brayns::Vector2f &range)
+    {
+        std::vector<uint8_t> indices(offsets.size());
+
+        auto rangeStart = range.x;
+        auto rangeEnd = range.y;
+        auto invFactor = 1.f / std::fabs(rangeEnd - rangeStart);
+
+#pragma omp parallel for
+        for (size_t i = 0; i < offsets.size(); ++i)
+        {
+            auto value = data[offsets[i]];
+            value = value > rangeEnd ? rangeEnd : (value < rangeStart ? rangeStart : value);
+            auto normIndex = (value - rangeStart) * invFactor;
+            indices[i] = static_cast<uint8_t>(normIndex * 255.f);
+        }
+
+        return indices;
+    }
+};
+
+class TestData
+{
+public:
+    static std::vector<float> values(size_t count)
+    {
+        auto engine = std::mt19937(42);
+        auto distribution = std::uniform_real_distribution<float>(-90.f, 30.f);
+        auto result = std::vector<float>(count);
+        for (auto &value : result)
+        {
+            value = distribution(engine);
+        }
+        return result;
+    }
+
+    static std::vector<size_t> offsets(size_t count, size_t valueCount)
+    {
+        auto engine = std::mt19937(7);
+        auto distribution = std::uniform_int_distribution<size_t>(0, valueCount - 1);
+        auto result = std::vector<size_t>(count);
+        for (auto &offset : result)
+        {
+            offset = distribution(engine);
+        }
+        return result;
+    }
+
+    static std::vector<size_t> identity(size_t count)
+    {
+        auto result = std::vector<size_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            result[i] = i;
+        }
+        return result;
+    }
+};
+
+class KernelScope
+{
+public:
+    explicit KernelScope(const std::string &name):
+        _previous(brayns::Quantizer::getKernelName())
+    {
+        brayns::Quantizer::setKernel(name);
+    }
+
+    ~KernelScope()
+    {
+        brayns::Quantizer::setKernel(_previous);
+    }
+
+    KernelScope(const KernelScope &) = delete;
+    KernelScope &operator=(const KernelScope &) = delete;
+
+private:
+    std::string _previous;
+};
+}
+
+TEST_CASE("Quantizer kernels")
+{
+    auto kernels = brayns::Quantizer::getAvailableKernels();
+    CHECK(!kernels.empty());
+    CHECK(kernels.front() == brayns::Quantizer::getKernelName());
+    CHECK(kernels.back() == "scalar");
+    CHECK_THROWS_AS(brayns::Quantizer::setKernel("unknown"), std::invalid_argument);
+}
+
+TEST_CASE("Quantizer")
+{
+    auto range = brayns::Vector2f(-80.f, 10.f);
+
+    for (const auto &kernel : brayns::Quantizer::getAvailableKernels())
+    {
+        CAPTURE(kernel);
+        auto scope = KernelScope(kernel);
+        CHECK(brayns::Quantizer::getKernelName() == kernel);
+
+        // Quantize
+        {
+            auto values = TestData::values(1003);
+            values[0] = -100.f;
+            values[1] = 100.f;
+            values[2] = -80.f;
+            values[3] = 10.f;
+
+            auto expected = LegacyIndexer::generate(values, TestData::identity(values.size()), range);
+
+            auto indices = std::vector<uint8_t>();
+            brayns::Quantizer::quantize(values, range, indices);
+
+            CHECK(indices == expected);
+            CHECK(indices[0] == 0);
+            CHECK(indices[1] == 255);
+        }
+
+        // Gather quantize
+        {
+            auto values = TestData::values(5000);
+            auto offsets = TestData::offsets(200'011, values.size());
+
+            auto expected = LegacyIndexer::generate(values, offsets, range);
+
+            auto indices = std::vector<uint8_t>(3, 0);
+            brayns::Quantizer::gatherQuantize(values, offsets, range, indices);
+
+            CHECK(indices == expected);
+        }
+
+        // Empty range
+        {
+            auto values = std::vector<float>(20, 1.f);
+            auto indices = std::vector<uint8_t>();
+            brayns::Quantizer::quantize(values, {1.f, 1.f}, indices);
+
+            CHECK(indices == std::vector<uint8_t>(20, 0));
+        }
+    }
+}
+
+// Run with --no-skip
+TEST_CASE("Quantizer benchmark" * doctest::skip())
+{
+    constexpr size_t compartmentCount = 32'000'000;
+
+    auto range = brayns::Vector2f(-80.f, 10.f);
+
+    auto values = TestData::values(compartmentCount / 4);
+    auto offsets = TestData::offsets(compartmentCount, values.size());
+    auto contiguous = TestData::values(compartmentCount);
+    auto identity = TestData::identity(compartmentCount);
+    auto indices = std::vector<uint8_t>(compartmentCount);
+
+    auto timer = brayns::Timer();
+    auto expectedGather = LegacyIndexer::generate(values, offsets, range);
+    auto legacy = timer.millis();
+
+    timer.reset();
+    auto expectedContiguous = LegacyIndexer::generate(contiguous, identity, range);
+    auto legacyContiguous = timer.millis();
+
+    MESSAGE("Legacy gather: " << legacy << " ms, contiguous: " << legacyContiguous << " ms");
+
+    for (const auto &kernel : brayns::Quantizer::getAvailableKernels())
+    {
+        auto scope = KernelScope(kernel);
+
+        timer.reset();
+        brayns::Quantizer::gatherQuantize(values, offsets, range, indices);
+        auto gather = timer.millis();
+
+        CHECK(indices == expectedGather);
+
+        timer.reset();
+        brayns::Quantizer::quantize(contiguous, range, indices);
+        auto quantize = timer.millis();
+
+        CHECK(indices == expectedContiguous);
+
+        MESSAGE("Kernel " << kernel << " gather: " << gather << " ms, contiguous: " << quantize << " ms");
+    }
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/utils/ThreadPool.h>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("ThreadPool")
+{
+    SUBCASE("Worker count")
+    {
+        auto pool = brayns::ThreadPool(3);
+        CHECK(pool.getWorkerCount() == 3);
+
+        auto automatic = brayns::ThreadPool();
+        CHECK(automatic.getWorkerCount() >= 1);
+    }
+    SUBCASE("Results")
+    {
+        auto pool = brayns::ThreadPool(4);
+        auto futures = std::vector<std::future<size_t>>();
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            futures.push_back(pool.submit([=] { return i * i; }));
+        }
+        for (size_t i = 0; i < futures.size(); ++i)
+        {
+            CHECK(futures[i].get() == i * i);
+        }
+    }
+    SUBCASE("Exceptions")
+    {
+        auto pool = brayns::ThreadPool(2);
+        auto future = pool.submit([]() -> int { throw std::runtime_error("Test"); });
+        CHECK_THROWS_AS(future.get(), std::runtime_error);
+        CHECK(pool.submit([] { return 1; }).get() == 1);
+    }
+    SUBCASE("Continuations")
+    {
+        auto pool = brayns::ThreadPool(4);
+        auto counter = std::atomic<size_t>(0);
+        auto children = std::vector<std::future<void>>(100);
+        auto parents = std::vector<std::future<void>>();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            parents.push_back(pool.submit(
+                [&, i]
+                {
+                    for (size_t j = 0; j < 10; ++j)
+                    {
+                        children[i * 10 + j] = pool.submit([&] { ++counter; });
+                    }
+                }));
+        }
+        for (auto &parent : parents)
+        {
+            parent.get();
+        }
+        for (auto &child : children)
+        {
+            child.get();
+        }
+        CHECK(counter == 100);
+    }
+    SUBCASE("Drain on destruction")
+    {
+        auto counter = std::atomic<size_t>(0);
+        {
+            auto pool = brayns::ThreadPool(2);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                pool.submit([&] { ++counter; });
+            }
+        }
+        CHECK(counter == 100);
+    }
+    SUBCASE("Default pool")
+    {
+        auto &pool = brayns::ThreadPool::getDefault();
+        CHECK(&pool == &brayns::ThreadPool::getDefault());
+        CHECK(pool.submit([] { return 42; }).get() == 42);
+    }
+}
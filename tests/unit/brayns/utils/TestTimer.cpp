@@ -36,4 +36,5 @@ TEST_CASE("Timer")
     timer.reset();
     std::this_thread::sleep_for(std::chrono::seconds(1));
     CHECK(timer.seconds() == 1);
+    CHECK(timer.millis() >= 1000);
 }
@@ -0,0 +1,51 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <api/circuit/CellPrimitiveRangesBuilder.h>
+
+#include <doctest/doctest.h>
+
+TEST_CASE("Cell primitive ranges builder")
+{
+    SUBCASE("Packing")
+    {
+        auto ranges = CellPrimitiveRangesBuilder::build({2, 1, 3, 1, 1}, 4);
+        CHECK(ranges.cellOffsets == std::vector<size_t>{0, 2, 3, 6, 7, 8});
+        CHECK(ranges.geometryCells == std::vector<size_t>{0, 2, 4, 5});
+    }
+    SUBCASE("Oversized cell")
+    {
+        auto ranges = CellPrimitiveRangesBuilder::build({1, 10, 1}, 4);
+        CHECK(ranges.cellOffsets == std::vector<size_t>{0, 1, 11, 12});
+        CHECK(ranges.geometryCells == std::vector<size_t>{0, 1, 2, 3});
+    }
+    SUBCASE("Single geometry")
+    {
+        auto ranges = CellPrimitiveRangesBuilder::build({3, 3, 3}, 1 << 20);
+        CHECK(ranges.cellOffsets == std::vector<size_t>{0, 3, 6, 9});
+        CHECK(ranges.geometryCells == std::vector<size_t>{0, 3});
+    }
+    SUBCASE("Empty")
+    {
+        auto ranges = CellPrimitiveRangesBuilder::build({}, 4);
+        CHECK(ranges.cellOffsets == std::vector<size_t>{0});
+        CHECK(ranges.geometryCells == std::vector<size_t>{0, 0});
+    }
+}
@@ -0,0 +1,166 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/engine/components/ColorList.h>
+#include <brayns/engine/components/ColorMap.h>
+#include <brayns/engine/components/Geometries.h>
+#include <brayns/engine/components/GeometryViews.h>
+#include <brayns/engine/geometry/types/Sphere.h>
+
+#include <api/circuit/CellPrimitiveRangesBuilder.h>
+#include <api/coloring/handlers/MergedColorHandler.h>
+
+#include <tests/unit/PlaceholderEngine.h>
+
+#include <doctest/doctest.h>
+
+namespace
+{
+class MergedCircuit
+{
+public:
+    MergedCircuit(const std::vector<size_t> &cellPrimitiveCounts, size_t maxPrimitivesPerGeometry):
+        ranges(CellPrimitiveRangesBuilder::build(cellPrimitiveCounts, maxPrimitivesPerGeometry)),
+        geometries(_buildPrimitives(ranges)),
+        views(geometries.elements)
+    {
+    }
+
+    CellPrimitiveRanges ranges;
+    brayns::Geometries geometries;
+    brayns::GeometryViews views;
+
+private:
+    static std::vector<std::vector<brayns::Sphere>> _buildPrimitives(const CellPrimitiveRanges &ranges)
+    {
+        auto &cellOffsets = ranges.cellOffsets;
+        auto &geometryCells = ranges.geometryCells;
+
+        auto primitives = std::vector<std::vector<brayns::Sphere>>();
+        for (size_t i = 0; i + 1 < geometryCells.size(); ++i)
+        {
+            auto count = cellOffsets[geometryCells[i + 1]] - cellOffsets[geometryCells[i]];
+            primitives.emplace_back(count, brayns::Sphere{brayns::Vector3f(0.f), 1.f});
+        }
+        return primitives;
+    }
+};
+
+class ViewChecker
+{
+public:
+    static bool allColorMaps(const brayns::GeometryViews &views)
+    {
+        for (auto &view : views.elements)
+        {
+            if (!view.hasColorMap())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool noColorMap(const brayns::GeometryViews &views)
+    {
+        for (auto &view : views.elements)
+        {
+            if (view.hasColorMap())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    static std::vector<size_t> colorVersions(const brayns::GeometryViews &views)
+    {
+        auto versions = std::vector<size_t>();
+        for (auto &view : views.elements)
+        {
+            versions.push_back(view.getColorVersion());
+        }
+        return versions;
+    }
+};
+}
+
+TEST_CASE("Merged color handler")
+{
+    BRAYNS_TESTS_PLACEHOLDER_ENGINE
+
+    SUBCASE("Few colors")
+    {
+        auto circuit = MergedCircuit({2, 1, 3}, 3);
+        CHECK(circuit.views.elements.size() == 2);
+
+        auto handler = MergedColorHandler(circuit.ranges);
+        auto red = brayns::Vector4f(1.f, 0.f, 0.f, 1.f);
+        auto blue = brayns::Vector4f(0.f, 0.f, 1.f, 1.f);
+        auto colors = brayns::ColorList{{red, blue, red}};
+
+        handler.colorByElement(colors, circuit.views);
+        CHECK(circuit.views.modified);
+        CHECK(ViewChecker::allColorMaps(circuit.views));
+    }
+    SUBCASE("Many colors")
+    {
+        auto cellCount = size_t(300);
+        auto circuit = MergedCircuit(std::vector<size_t>(cellCount, 2), 256);
+        CHECK(circuit.views.elements.size() == 3);
+
+        auto handler = MergedColorHandler(circuit.ranges);
+        auto colors = brayns::ColorList();
+        for (size_t i = 0; i < cellCount; ++i)
+        {
+            colors.elements.emplace_back(static_cast<float>(i) / static_cast<float>(cellCount), 0.f, 0.f, 1.f);
+        }
+
+        handler.colorByElement(colors, circuit.views);
+        CHECK(ViewChecker::noColorMap(circuit.views));
+
+        colors.elements.resize(256);
+        colors.elements.resize(cellCount, colors.elements.front());
+        handler.colorByElement(colors, circuit.views);
+        CHECK(ViewChecker::allColorMaps(circuit.views));
+    }
+    SUBCASE("Colormap")
+    {
+        auto circuit = MergedCircuit({2, 1, 3}, 3);
+
+        auto handler = MergedColorHandler(circuit.ranges);
+        auto colors = brayns::ColorList{std::vector<brayns::Vector4f>(3, brayns::Vector4f(1.f))};
+        handler.colorByElement(colors, circuit.views);
+
+        auto colorMap = brayns::ColorMap();
+        colorMap.indices = {0, 1, 0, 1, 0, 1};
+        colorMap.colors = {brayns::Vector4f(1.f), brayns::Vector4f(0.f, 0.f, 0.f, 1.f)};
+
+        circuit.views.modified = false;
+        handler.colorByColormap(colorMap, circuit.geometries, circuit.views);
+        CHECK(circuit.views.modified);
+        CHECK(ViewChecker::allColorMaps(circuit.views));
+
+        // Coloring by element also binds colormaps, to the palette, so only the version tells the bindings apart
+        auto versions = ViewChecker::colorVersions(circuit.views);
+        handler.colorByElement(colors, circuit.views);
+        CHECK(ViewChecker::allColorMaps(circuit.views));
+        CHECK(ViewChecker::colorVersions(circuit.views) != versions);
+    }
+}
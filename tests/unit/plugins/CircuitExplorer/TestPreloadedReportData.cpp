@@ -0,0 +1,255 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <api/reports/PreloadedReportData.h>
+#include <api/reports/ReportFrames.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+class FakeReportData : public IReportData
+{
+public:
+    explicit FakeReportData(std::vector<std::vector<float>> frames):
+        _frames(std::move(frames))
+    {
+    }
+
+    double getStartTime() const noexcept override
+    {
+        return 0.0;
+    }
+
+    double getEndTime() const noexcept override
+    {
+        return static_cast<double>(_frames.size());
+    }
+
+    double getTimeStep() const noexcept override
+    {
+        return 1.0;
+    }
+
+    std::string getTimeUnit() const noexcept override
+    {
+        return "ms";
+    }
+
+    std::vector<float> getFrame(double timestamp) const override
+    {
+        return _frames[ReportFrames::toIndex(*this, timestamp)];
+    }
+
+private:
+    std::vector<std::vector<float>> _frames;
+};
+
+class FrameGenerator
+{
+public:
+    static inline constexpr size_t elementCount = 64;
+
+    static std::vector<float> wave(size_t index)
+    {
+        auto frame = std::vector<float>(elementCount);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            auto phase = 0.1f * static_cast<float>(i) + 0.05f * static_cast<float>(index);
+            frame[i] = 100.f * std::sin(phase) - 20.f;
+        }
+        return frame;
+    }
+
+    static std::vector<std::vector<float>> waves(size_t frameCount)
+    {
+        auto frames = std::vector<std::vector<float>>();
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            frames.push_back(wave(i));
+        }
+        return frames;
+    }
+};
+
+class ReconstructionError
+{
+public:
+    static float compute(const IReportData &source, const PreloadedReportData &preloaded, size_t index)
+    {
+        auto timestamp = ReportFrames::toTimestamp(source, index);
+        auto expected = source.getFrame(timestamp);
+        auto decoded = preloaded.getFrame(timestamp);
+
+        auto error = 0.f;
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            error = std::max(error, std::fabs(decoded[i] - expected[i]));
+        }
+        return error;
+    }
+
+    // Largest quantization step of a frame, key frames of the delta mode are quantized in a range widened by 25% on
+    // each side so their step is bounded from the extent of all the frames
+    static float getStep(const std::vector<std::vector<float>> &frames, size_t index, ReportPreload mode)
+    {
+        if (mode == ReportPreload::Quantized16Delta)
+        {
+            auto minValue = frames[0][0];
+            auto maxValue = frames[0][0];
+            for (auto &frame : frames)
+            {
+                auto [first, last] = std::minmax_element(frame.begin(), frame.end());
+                minValue = std::min(minValue, *first);
+                maxValue = std::max(maxValue, *last);
+            }
+            return 1.5f * (maxValue - minValue) / 65535.f;
+        }
+
+        auto &frame = frames[index];
+        auto [first, last] = std::minmax_element(frame.begin(), frame.end());
+        auto extent = *last - *first;
+        return mode == ReportPreload::Quantized8 ? extent / 255.f : extent / 65535.f;
+    }
+};
+
+class ErrorChecker
+{
+public:
+    static void check(
+        const std::vector<std::vector<float>> &frames,
+        ReportPreload mode,
+        const std::vector<size_t> &order)
+    {
+        auto source = FakeReportData(frames);
+        auto preloaded = PreloadedReportData(source, mode);
+
+        for (auto index : order)
+        {
+            auto error = ReconstructionError::compute(source, preloaded, index);
+            auto step = ReconstructionError::getStep(frames, index, mode);
+            CAPTURE(index);
+            CHECK(error <= step);
+        }
+    }
+
+    static std::vector<size_t> forward(size_t frameCount)
+    {
+        auto order = std::vector<size_t>(frameCount);
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            order[i] = i;
+        }
+        return order;
+    }
+};
+}
+
+TEST_CASE("Preloaded report data")
+{
+    SUBCASE("Invalid mode")
+    {
+        auto source = FakeReportData(FrameGenerator::waves(2));
+        CHECK_THROWS_AS(PreloadedReportData(source, ReportPreload::None), std::invalid_argument);
+    }
+    SUBCASE("Different frame sizes")
+    {
+        auto frames = FrameGenerator::waves(2);
+        frames[1].pop_back();
+        auto source = FakeReportData(frames);
+        CHECK_THROWS_AS(PreloadedReportData(source, ReportPreload::Quantized16), std::runtime_error);
+    }
+    SUBCASE("Reconstruction error")
+    {
+        auto frameCount = size_t(40);
+        auto frames = FrameGenerator::waves(frameCount);
+        auto order = ErrorChecker::forward(frameCount);
+
+        for (auto mode : {ReportPreload::Quantized8, ReportPreload::Quantized16, ReportPreload::Quantized16Delta})
+        {
+            CAPTURE(static_cast<int>(mode));
+            ErrorChecker::check(frames, mode, order);
+        }
+    }
+    SUBCASE("Range bounds")
+    {
+        auto frames = FrameGenerator::waves(1);
+        auto source = FakeReportData(frames);
+        auto preloaded = PreloadedReportData(source, ReportPreload::Quantized8);
+
+        auto decoded = preloaded.getFrame(0.0);
+        auto [first, last] = std::minmax_element(frames[0].begin(), frames[0].end());
+        CHECK(*std::min_element(decoded.begin(), decoded.end()) >= *first);
+        CHECK(*std::max_element(decoded.begin(), decoded.end()) == *last);
+    }
+    SUBCASE("Delta escapes")
+    {
+        // Single elements jumping across the range do not fit in an 8 bit delta
+        auto frames = FrameGenerator::waves(4);
+        frames[1][3] = frames[0][16];
+        frames[2][3] = frames[0][48];
+
+        // Too many escapes store a key frame instead
+        for (size_t i = 0; i < FrameGenerator::elementCount / 2; ++i)
+        {
+            frames[3][i] = frames[0][FrameGenerator::elementCount - 1 - i];
+        }
+
+        ErrorChecker::check(frames, ReportPreload::Quantized16Delta, ErrorChecker::forward(frames.size()));
+    }
+    SUBCASE("Frames leaving the key range")
+    {
+        auto frames = FrameGenerator::waves(6);
+        frames[2][5] = 300.f;
+        frames[4][7] = -300.f;
+
+        ErrorChecker::check(frames, ReportPreload::Quantized16Delta, ErrorChecker::forward(frames.size()));
+    }
+    SUBCASE("Backward and random access")
+    {
+        auto frameCount = size_t(100);
+        auto frames = FrameGenerator::waves(frameCount);
+
+        auto order = ErrorChecker::forward(frameCount);
+        std::reverse(order.begin(), order.end());
+        ErrorChecker::check(frames, ReportPreload::Quantized16Delta, order);
+
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            order[i] = (i * 37) % frameCount;
+        }
+        ErrorChecker::check(frames, ReportPreload::Quantized16Delta, order);
+    }
+    SUBCASE("Repeated decoding")
+    {
+        auto frames = FrameGenerator::waves(70);
+        auto source = FakeReportData(frames);
+        auto preloaded = PreloadedReportData(source, ReportPreload::Quantized16Delta);
+
+        auto timestamp = ReportFrames::toTimestamp(source, 40);
+        auto sequential = preloaded.getFrame(timestamp);
+        preloaded.getFrame(ReportFrames::toTimestamp(source, 69));
+        preloaded.getFrame(ReportFrames::toTimestamp(source, 3));
+        CHECK(preloaded.getFrame(timestamp) == sequential);
+    }
+}
@@ -0,0 +1,102 @@
+/* Copyright (c) 2015-2024, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ * Responsible author: Nadir Roman Guerrero <nadir.romanguerrero@epfl.ch>
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <api/reports/SpikeStore.h>
+
+#include <doctest/doctest.h>
+
+namespace
+{
+struct StoredSpike
+{
+    size_t cell;
+    float time;
+
+    bool operator==(const StoredSpike &other) const noexcept = default;
+};
+
+class SpikeCollector
+{
+public:
+    static std::vector<StoredSpike> collect(const SpikeStore &store, float start, float end)
+    {
+        auto spikes = std::vector<StoredSpike>();
+        store.forEach(start, end, [&](size_t cell, float time) { spikes.push_back({cell, time}); });
+        return spikes;
+    }
+};
+}
+
+TEST_CASE("Spike store")
+{
+    SUBCASE("Unsorted spikes")
+    {
+        auto store = SpikeStore({0, 1, 2}, {{1, 3.0}, {0, 1.0}, {2, 2.0}, {0, 2.0}});
+        CHECK(store.getCellCount() == 3);
+        CHECK(store.getSpikeCount() == 4);
+
+        auto spikes = SpikeCollector::collect(store, 0.f, 10.f);
+        auto expected = std::vector<StoredSpike>{{0, 1.f}, {2, 2.f}, {0, 2.f}, {1, 3.f}};
+        CHECK(spikes == expected);
+    }
+    SUBCASE("Unselected cells")
+    {
+        auto store = SpikeStore({4, 2}, {{3, 1.0}, {2, 2.0}, {7, 3.0}, {4, 4.0}, {0, 5.0}});
+        CHECK(store.getCellCount() == 2);
+        CHECK(store.getSpikeCount() == 2);
+
+        auto spikes = SpikeCollector::collect(store, 0.f, 10.f);
+        auto expected = std::vector<StoredSpike>{{1, 2.f}, {0, 4.f}};
+        CHECK(spikes == expected);
+    }
+    SUBCASE("No selection")
+    {
+        auto store = SpikeStore({}, {{0, 1.0}, {1, 2.0}});
+        CHECK(store.getCellCount() == 0);
+        CHECK(store.getSpikeCount() == 0);
+        CHECK(SpikeCollector::collect(store, 0.f, 10.f).empty());
+    }
+    SUBCASE("Window boundaries")
+    {
+        auto store = SpikeStore({0, 1, 2}, {{0, 1.0}, {1, 2.0}, {2, 3.0}});
+
+        auto expected = std::vector<StoredSpike>{{0, 1.f}, {1, 2.f}};
+        CHECK(SpikeCollector::collect(store, 1.f, 2.f) == expected);
+
+        expected = {{1, 2.f}};
+        CHECK(SpikeCollector::collect(store, 2.f, 2.f) == expected);
+
+        expected = {{2, 3.f}};
+        CHECK(SpikeCollector::collect(store, 3.f, 10.f) == expected);
+
+        CHECK(SpikeCollector::collect(store, 2.5f, 2.9f).empty());
+        CHECK(SpikeCollector::collect(store, 3.5f, 10.f).empty());
+        CHECK(SpikeCollector::collect(store, 0.f, 0.5f).empty());
+    }
+    SUBCASE("Dense id mapping")
+    {
+        auto store = SpikeStore({10, 3, 7}, {{7, 1.0}, {10, 2.0}, {3, 3.0}, {11, 4.0}});
+        CHECK(store.getSpikeCount() == 3);
+
+        auto spikes = SpikeCollector::collect(store, 0.f, 10.f);
+        auto expected = std::vector<StoredSpike>{{2, 1.f}, {0, 2.f}, {1, 3.f}};
+        CHECK(spikes == expected);
+    }
+}